@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iterator> // std::next
+
+#include "plf_hive.h"
+#include "plf_nanotimer.h"
+#include "plf_rand.h"
+
+
+// Compares hive_priority::performance, memory_use and bitset after scattered single erasures - iteration, advance/distance, range-erase and memory use. Output is csv.
+
+template <plf::hive_priority priority>
+void benchmark_priority(const char *priority_name, const unsigned int number_of_elements, const unsigned int erasure_percentage, const unsigned int number_of_runs)
+{
+	typedef plf::hive<unsigned int, std::allocator<unsigned int>, priority> hive_type;
+
+	plf::srand(number_of_elements + erasure_percentage);
+	hive_type container;
+	container.reserve(number_of_elements);
+
+	for (unsigned int counter = 0; counter != number_of_elements; ++counter)
+	{
+		container.insert(counter);
+	}
+
+	for (typename hive_type::iterator current = container.begin(); current != container.end();)
+	{
+		if ((plf::rand() % 100) < erasure_percentage)
+		{
+			current = container.erase(current);
+		}
+		else
+		{
+			++current;
+		}
+	}
+
+	plf::nanotimer timer;
+	unsigned int total = 0;
+	double iterate_time = 0, advance_time = 0, range_erase_time = 0;
+
+	for (unsigned int run = 0; run != number_of_runs; ++run)
+	{
+		timer.start();
+
+		for (typename hive_type::iterator current = container.begin(); current != container.end(); ++current)
+		{
+			total += *current;
+		}
+
+		iterate_time += timer.get_elapsed_us();
+
+		timer.start();
+
+		for (unsigned int step = 1; step != 65; ++step)
+		{
+			typename hive_type::iterator current = container.begin();
+			advance(current, (container.size() * step) / 64);
+			total += static_cast<unsigned int>(distance(container.begin(), current));
+		}
+
+		advance_time += timer.get_elapsed_us();
+	}
+
+	for (unsigned int run = 0; run != number_of_runs; ++run)
+	{
+		hive_type copy(container);
+		const typename hive_type::iterator first = std::next(copy.begin(), copy.size() / 4), last = std::next(copy.begin(), (copy.size() * 3) / 4);
+
+		timer.start();
+		copy.erase(first, last);
+		range_erase_time += timer.get_elapsed_us();
+		total += static_cast<unsigned int>(copy.size());
+	}
+
+	std::cout << priority_name << ", " << number_of_elements << ", " << erasure_percentage << ", " << (iterate_time / number_of_runs) << ", " << (advance_time / number_of_runs) << ", " << (range_erase_time / number_of_runs) << ", " << container.memory() << ", " << (total & 1) << std::endl;
+}
+
+
+
+int main()
+{
+	std::cout << "Priority, Number of elements, Erasure percentage, Iterate (us), 64 advance + distance (us), Range-erase half (us), memory() (bytes), ignore" << std::endl;
+
+	const unsigned int erasure_percentages[] = {0, 1, 5, 10, 25, 50};
+
+	for (unsigned int number_of_elements = 1000; number_of_elements <= 1000000; number_of_elements *= 10)
+	{
+		const unsigned int number_of_runs = 10000000 / number_of_elements;
+
+		for (const unsigned int erasure_percentage : erasure_percentages)
+		{
+			benchmark_priority<plf::hive_priority::performance>("performance", number_of_elements, erasure_percentage, number_of_runs);
+			benchmark_priority<plf::hive_priority::memory_use>("memory_use", number_of_elements, erasure_percentage, number_of_runs);
+			benchmark_priority<plf::hive_priority::bitset>("bitset", number_of_elements, erasure_percentage, number_of_runs);
+		}
+	}
+
+	return 0;
+}
@@ -220,17 +220,14 @@
 #include <memory> // std::allocator
 #include <iterator> // std::bidirectional_iterator_tag, iterator_traits, make_move_iterator, std::distance for range insert
 #include <stdexcept> // std::length_error
+#include <utility> // std::pair, std::move
 
 
 #ifdef PLF_TYPE_TRAITS_SUPPORT
-	#include <cstddef> // offsetof, used in blank()
+	#include <cstddef> // std::ptrdiff_t, size_t
 	#include <type_traits> // std::is_trivially_destructible, etc
 #endif
 
-#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-	#include <utility> // std::move
-#endif
-
 #ifdef PLF_INITIALIZER_LIST_SUPPORT
 	#include <initializer_list>
 #endif
@@ -239,6 +236,33 @@
 	#include <concepts>
 #endif
 
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L // ie. <algorithm> declares the execution-policy overloads, used by for_each_parallel()
+	#define PLF_EXECUTION_POLICY_SUPPORT
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) // Used for scanning skipfields multiple nodes at a time
+	#define PLF_SSE2_SUPPORT
+	#include <cstddef> // std::ptrdiff_t
+	#include <emmintrin.h>
+
+	#ifdef __AVX2__
+		#define PLF_AVX2_SUPPORT
+		#include <immintrin.h>
+	#endif
+
+	#if defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
+		#include <intrin.h> // _BitScanForward, _BitScanReverse
+	#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__) // Software prefetch hint for read, used by for_each_prefetched()
+	#define PLF_PREFETCH(address) __builtin_prefetch(static_cast<const void *>(address), 0, 3)
+#elif defined(PLF_SSE2_SUPPORT)
+	#define PLF_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0)
+#else
+	#define PLF_PREFETCH(address)
+#endif
+
 
 namespace plf
 {
@@ -250,11 +274,82 @@ struct colony_limits // for use in block_capacity setting/getting functions and
 };
 
 
+struct colony_statistics // returned by colony::statistics()
+{
+	static const size_t fill_buckets = 8, capacity_buckets = 16;
+
+	size_t number_of_groups;						// Active groups ie. those holding elements
+	size_t number_of_groups_with_erasures;		// Active groups with reusable erased locations
+	size_t number_of_unused_groups;				// Empty groups retained for reuse
+	size_t total_skipblocks;						// Runs of erased elements across all active groups
+	size_t fill_histogram[fill_buckets];		// Active groups by size / capacity: bucket N holds groups with a fill of at least N eighths. Full groups are in the last bucket
+	size_t capacity_histogram[capacity_buckets]; // Active groups by capacity: bucket N holds groups with a capacity of 2^N to (2^(N + 1)) - 1
+	size_t group_allocations, group_deallocations, group_recycles; // Counted over the colony's lifetime only if PLF_COLONY_ALLOCATION_COUNTERS is defined before including this header, otherwise zero. A recycle is the reuse of an unused group in place of an allocation
+};
+
+
+
+struct colony_growth_state // passed to a colony's growth policy whenever insert() needs to allocate a new group
+{
+	size_t size, capacity;				// The colony's current size and capacity
+	size_t back_group_capacity;		// Capacity of the back group, which has been filled by appended elements since it was added
+	size_t reuses;							// Since the policy was last called: insertions into erased element locations, plus the capacity of any unused groups reused in place of an allocation
+	size_t min_capacity, max_capacity; // The colony's block capacity limits - the returned capacity is clamped to these
+};
+
+
+typedef size_t (*colony_growth_policy)(const colony_growth_state &state); // Returns the capacity of the next group to allocate
+
+
+// A growth policy for workloads alternating between bursts of growth and steady churn. During bursts (insertions almost all appending) total capacity triples on each allocation rather than doubling, reducing allocations. During churn (memory mostly being reused) each new group is half the size of the last, reducing stranded capacity:
+inline size_t colony_adaptive_growth(const colony_growth_state &state) PLF_NOEXCEPT
+{
+	const size_t insertions = state.back_group_capacity + state.reuses;
+
+	if (state.reuses <= insertions / 8)
+	{
+		return state.size * 2;
+	}
+	else if (state.reuses >= insertions / 2)
+	{
+		return state.back_group_capacity / 2;
+	}
+
+	return state.size;
+}
+
+
+
 enum colony_priority { performance, memory_use };
 
 
 
-template <class element_type, class allocator_type = std::allocator<element_type>, plf::colony_priority priority = plf::performance> class colony : private allocator_type // Empty base class optimisation (EBCO) - inheriting allocator functions
+// Storage details for a colony's cold values (see colony::cold). A cold_type of void means no cold values are stored:
+template <class cold_type> struct colony_cold_traits
+{
+	typedef cold_type storage_type;
+
+	#ifdef PLF_ALIGNMENT_SUPPORT
+		static const size_t alignment = alignof(cold_type);
+	#else
+		struct alignment_finder { char offset; cold_type value; };
+		static const size_t alignment = sizeof(alignment_finder) - sizeof(cold_type);
+	#endif
+
+	static const size_t size = sizeof(cold_type);
+};
+
+
+
+template <> struct colony_cold_traits<void>
+{
+	typedef unsigned char storage_type; // placeholder - never stored
+	static const size_t alignment = 1, size = 0;
+};
+
+
+
+template <class element_type, class allocator_type = std::allocator<element_type>, plf::colony_priority priority = plf::performance, bool generational = false, class cold_type = void> class colony : private allocator_type // Empty base class optimisation (EBCO) - inheriting allocator functions
 {
 	// Type-switching pattern:
 	template <bool flag, class is_true, class is_false> struct choose;
@@ -270,6 +365,7 @@ template <class element_type, class allocator_type = std::allocator<element_type
 	};
 
 	typedef typename choose<priority == plf::performance, unsigned short, unsigned char>::type		skipfield_type; // Note: unsigned short is equivalent to uint_least16_t ie. Using 16-bit unsigned integer in best-case scenario, greater-than-16-bit unsigned integer where platform doesn't support 16-bit types. unsigned char is always == 1 byte, as opposed to uint_8, which may not be
+	typedef unsigned short		generation_type; // Generational mode only. At least 16 bits regardless of priority, as an 8-bit memory_use skipfield_type would let handles compare as valid again after only 256 reuses of a location
 
 public:
 	// Standard container typedefs:
@@ -315,20 +411,26 @@ public:
 
 private:
 
+	typedef plf::colony_cold_traits<cold_type>	cold_traits;
+	typedef typename cold_traits::storage_type	cold_storage_type;
+
+	#define PLF_GENERATION_BLOCK_BYTES(elements_per_group) ((!generational) ? 0 : sizeof(generation_type) - 1 + (elements_per_group * sizeof(generation_type))) // Generation counters are stored after the skipfield, aligned for generation_type, so the worst-case alignment padding is included
+	#define PLF_COLD_BLOCK_BYTES(elements_per_group) ((cold_traits::size == 0) ? 0 : cold_traits::alignment - 1 + (elements_per_group * cold_traits::size)) // Cold values are stored after the skipfield (and generations), so the worst-case alignment padding is included
+
 	#ifdef PLF_ALIGNMENT_SUPPORT
 		struct alignas(alignof(aligned_element_type)) aligned_allocation_struct
 		{
 		  char data[alignof(aligned_element_type)]; // Using char as sizeof is always guaranteed to be 1 byte regardless of the number of bits in a byte on given computer, whereas for example, uint8_t would fail on machines where there are more than 8 bits in a byte eg. Texas Instruments C54x DSPs.
 		};
 
-		#define PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group) ((((elements_per_group * (((sizeof(aligned_element_type) >= alignof(aligned_element_type)) ? sizeof(aligned_element_type) : alignof(aligned_element_type)) + sizeof(skipfield_type))) + sizeof(skipfield_type)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct)) // The size of a groups' memory block when expressed in multiples of the value_type's alignment. We also check to see if alignment is larger than sizeof value_type and use alignment size if so.
+		#define PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group) ((((elements_per_group * (((sizeof(aligned_element_type) >= alignof(aligned_element_type)) ? sizeof(aligned_element_type) : alignof(aligned_element_type)) + sizeof(skipfield_type))) + sizeof(skipfield_type) + PLF_GENERATION_BLOCK_BYTES(elements_per_group) + PLF_COLD_BLOCK_BYTES(elements_per_group)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct)) // The size of a groups' memory block when expressed in multiples of the value_type's alignment. We also check to see if alignment is larger than sizeof value_type and use alignment size if so. In generational mode the block also holds one generation counter per element, after the skipfield. Cold values, if any, come last.
 	#else
 		struct aligned_allocation_struct
 		{
 		  char data;
 		};
 
-		#define PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group) ((elements_per_group * (sizeof(aligned_element_type) + sizeof(skipfield_type))) + sizeof(skipfield_type)) // The size of a groups' memory block when expressed in bytes, since no alignment available
+		#define PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group) ((elements_per_group * (sizeof(aligned_element_type) + sizeof(skipfield_type))) + sizeof(skipfield_type) + PLF_GENERATION_BLOCK_BYTES(elements_per_group) + PLF_COLD_BLOCK_BYTES(elements_per_group)) // The size of a groups' memory block when expressed in bytes, since no alignment available
 	#endif
 
 
@@ -344,12 +446,14 @@ private:
 		typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_allocation_struct> aligned_struct_allocator_type;
 		typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<item_index_tuple> 			tuple_allocator_type;
 		typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<unsigned char> 				uchar_allocator_type;
+		typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<cold_storage_type> 			cold_allocator_type;
 
 		typedef typename std::allocator_traits<aligned_element_allocator_type>::pointer	aligned_pointer_type; // pointer to the overaligned element type, not the original element type
 		typedef typename std::allocator_traits<group_allocator_type>::pointer				group_pointer_type;
 		typedef typename std::allocator_traits<skipfield_allocator_type>::pointer			skipfield_pointer_type;
 		typedef typename std::allocator_traits<aligned_struct_allocator_type>::pointer	aligned_struct_pointer_type;
 		typedef typename std::allocator_traits<tuple_allocator_type>::pointer				tuple_pointer_type;
+		typedef typename std::allocator_traits<cold_allocator_type>::pointer				cold_pointer_type;
 	#else
 		typedef typename allocator_type::template rebind<aligned_element_type>::other 	aligned_element_allocator_type;	// In case compiler supports alignment but not allocator_traits
 		typedef typename allocator_type::template rebind<group>::other 						group_allocator_type;
@@ -357,12 +461,14 @@ private:
 		typedef typename allocator_type::template rebind<char>::other							aligned_struct_allocator_type;
 		typedef typename allocator_type::template rebind<item_index_tuple>::other			tuple_allocator_type;
 		typedef typename allocator_type::template rebind<unsigned char>::other				uchar_allocator_type;
+		typedef typename allocator_type::template rebind<cold_storage_type>::other			cold_allocator_type;
 
 		typedef typename aligned_element_allocator_type::pointer aligned_pointer_type;
 		typedef typename group_allocator_type::pointer				group_pointer_type;
 		typedef typename skipfield_allocator_type::pointer 		skipfield_pointer_type;
 		typedef typename aligned_struct_allocator_type::pointer	aligned_struct_pointer_type;
 		typedef typename tuple_allocator_type::pointer				tuple_pointer_type;
+		typedef typename cold_allocator_type::pointer				cold_pointer_type;
 	#endif
 
 
@@ -386,7 +492,8 @@ private:
 
 
 		#ifdef PLF_VARIADICS_SUPPORT
-			group(const skipfield_type elements_per_group, group_pointer_type const previous):
+			group(const aligned_struct_allocator_type &alloc, const skipfield_type elements_per_group, group_pointer_type const previous):
+				aligned_struct_allocator_type(alloc),
 				last_endpoint(reinterpret_cast<aligned_pointer_type>(PLF_ALLOCATE(aligned_struct_allocator_type, *this, PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group), (previous == NULL) ? 0 : previous->elements))), /* Because this variable occurs first in the struct, we allocate here initially, then increment its value in the element initialisation below. As opposed to doing a secondary assignment in the code */
 				next_group(NULL),
 				elements(last_endpoint++),
@@ -400,11 +507,22 @@ private:
 			{
 				// Static casts to unsigned int from short not necessary as C++ automatically promotes lesser types for arithmetic purposes.
 				std::memset(&*skipfield, 0, sizeof(skipfield_type) * (static_cast<size_type>(elements_per_group) + 1u)); // &* to avoid problems with non-trivial pointers
+
+				if (generational)
+				{
+					std::memset(static_cast<void *>(generations()), 0, sizeof(generation_type) * static_cast<size_type>(elements_per_group));
+				}
+
+				if (cold_traits::size != 0)
+				{
+					std::memset(static_cast<void *>(cold_values()), 0, cold_traits::size * static_cast<size_type>(elements_per_group));
+				}
 			}
 
 		#else
 			// This is a hack around the fact that allocator_type::construct only supports copy construction in C++03 and copy elision does not occur on the vast majority of compilers in this circumstance. So to avoid running out of memory (and losing performance) from allocating the same block twice, we're allocating in the 'copy' constructor.
-			group(const skipfield_type elements_per_group, group_pointer_type const previous) PLF_NOEXCEPT:
+			group(const aligned_struct_allocator_type &alloc, const skipfield_type elements_per_group, group_pointer_type const previous) PLF_NOEXCEPT:
+				aligned_struct_allocator_type(alloc),
 				elements(NULL),
 				skipfield(NULL),
 				previous_group(previous),
@@ -428,6 +546,16 @@ private:
 				group_number((source.previous_group == NULL) ? 0 : source.previous_group->group_number + 1u)
 			{
 				std::memset(&*skipfield, 0, sizeof(skipfield_type) * (static_cast<size_type>(capacity) + 1u));
+
+				if (generational)
+				{
+					std::memset(static_cast<void *>(generations()), 0, sizeof(generation_type) * static_cast<size_type>(capacity));
+				}
+
+				if (cold_traits::size != 0)
+				{
+					std::memset(static_cast<void *>(cold_values()), 0, cold_traits::size * static_cast<size_type>(capacity));
+				}
 			}
 		#endif
 
@@ -443,7 +571,25 @@ private:
 			erasures_list_next_group = NULL;
 			group_number = group_num;
 
-			std::memset(&*skipfield, 0, sizeof(skipfield_type) * static_cast<size_type>(capacity)); // capacity + 1 is not necessary here as the end skipfield is never written to after initialization
+			std::memset(&*skipfield, 0, sizeof(skipfield_type) * static_cast<size_type>(capacity)); // capacity + 1 is not necessary here as the end skipfield is never written to after initialization. Generation counters are deliberately left as-is, so that handles to previously-erased elements remain invalid
+		}
+
+
+
+		// Generational mode only - one counter per element, stored after the skipfield (including its extra node), aligned for generation_type. Incremented whenever the element at that index is erased:
+		inline generation_type * generations() const PLF_NOEXCEPT
+		{
+			char * const generations_start = reinterpret_cast<char *>(&*(skipfield + capacity + 1u));
+			return reinterpret_cast<generation_type *>(generations_start + ((sizeof(generation_type) - (reinterpret_cast<size_t>(generations_start) % sizeof(generation_type))) % sizeof(generation_type)));
+		}
+
+
+
+		// Cold values only - one per element, stored after the skipfield and generations, aligned for cold_type. Values for never-used indexes are zero:
+		inline cold_storage_type * cold_values() const PLF_NOEXCEPT
+		{
+			char * const cold_start = (generational) ? reinterpret_cast<char *>(generations() + capacity) : reinterpret_cast<char *>(&*(skipfield + capacity + 1u));
+			return reinterpret_cast<cold_storage_type *>(cold_start + ((cold_traits::alignment - (reinterpret_cast<size_t>(cold_start) % cold_traits::alignment)) % cold_traits::alignment));
 		}
 
 
@@ -457,6 +603,226 @@ private:
 
 
 
+	// Skipfield scanning, used by bulk operations over runs of non-erased elements (advance, range-erase, for_each_block). A zero skipfield node always represents a non-erased element, so runs of non-erased elements can be found by searching for the next non-zero node. Where SSE2 or AVX2 are available this tests 16 or 32 bytes of skipfield per instruction:
+
+	#ifdef PLF_SSE2_SUPPORT
+		static inline unsigned int lowest_set_bit(const unsigned int value) PLF_NOEXCEPT // value must be non-zero
+		{
+			#if defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
+				unsigned long index;
+				_BitScanForward(&index, value);
+				return static_cast<unsigned int>(index);
+			#else
+				return static_cast<unsigned int>(__builtin_ctz(value));
+			#endif
+		}
+
+
+
+		static inline unsigned int highest_set_bit(const unsigned int value) PLF_NOEXCEPT // value must be non-zero
+		{
+			#if defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
+				unsigned long index;
+				_BitScanReverse(&index, value);
+				return static_cast<unsigned int>(index);
+			#else
+				return static_cast<unsigned int>(31 - __builtin_clz(value));
+			#endif
+		}
+	#endif
+
+
+
+	// Returns the first non-zero node (ie. the start node of a skipblock) in the range [current, end), or end if all nodes in the range are zero:
+	static skipfield_pointer_type find_skipblock(skipfield_pointer_type current, const skipfield_pointer_type end) PLF_NOEXCEPT
+	{
+		#ifdef PLF_SSE2_SUPPORT
+			if PLF_CONSTEXPR (sizeof(skipfield_type) <= 2) // ie. unsigned char or 16-bit unsigned short
+			{
+				if (current != end)
+				{
+					const skipfield_type * const scan_begin = &*current;
+					const skipfield_type * const scan_end = scan_begin + (end - current);
+					const skipfield_type *node = scan_begin;
+
+					#ifdef PLF_AVX2_SUPPORT
+						for (const __m256i zero = _mm256_setzero_si256(); scan_end - node >= static_cast<std::ptrdiff_t>(sizeof(__m256i) / sizeof(skipfield_type)); node += sizeof(__m256i) / sizeof(skipfield_type))
+						{
+							const __m256i nodes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(node));
+							const unsigned int zero_mask = static_cast<unsigned int>(_mm256_movemask_epi8((sizeof(skipfield_type) == 1) ? _mm256_cmpeq_epi8(nodes, zero) : _mm256_cmpeq_epi16(nodes, zero)));
+
+							if (zero_mask != 0xFFFFFFFFu)
+							{
+								return current + ((node - scan_begin) + (lowest_set_bit(~zero_mask) / sizeof(skipfield_type)));
+							}
+						}
+					#endif
+
+					for (const __m128i zero = _mm_setzero_si128(); scan_end - node >= static_cast<std::ptrdiff_t>(sizeof(__m128i) / sizeof(skipfield_type)); node += sizeof(__m128i) / sizeof(skipfield_type))
+					{
+						const __m128i nodes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(node));
+						const unsigned int zero_mask = static_cast<unsigned int>(_mm_movemask_epi8((sizeof(skipfield_type) == 1) ? _mm_cmpeq_epi8(nodes, zero) : _mm_cmpeq_epi16(nodes, zero)));
+
+						if (zero_mask != 0xFFFFu)
+						{
+							return current + ((node - scan_begin) + (lowest_set_bit(~zero_mask & 0xFFFFu) / sizeof(skipfield_type)));
+						}
+					}
+
+					current += node - scan_begin;
+				}
+			}
+		#endif
+
+		while (current != end && *current == 0)
+		{
+			++current;
+		}
+
+		return current;
+	}
+
+
+
+	// The reverse of the above - returns the first node of the run of zero nodes which ends at current, not extending further back than begin. ie. the returned node is either begin or is preceded by the end node of a skipblock:
+	static skipfield_pointer_type find_skipblock_reverse(const skipfield_pointer_type begin, skipfield_pointer_type current) PLF_NOEXCEPT
+	{
+		#ifdef PLF_SSE2_SUPPORT
+			if PLF_CONSTEXPR (sizeof(skipfield_type) <= 2)
+			{
+				if (current != begin)
+				{
+					const skipfield_type * const scan_end = &*(current - 1) + 1;
+					const skipfield_type * const scan_begin = scan_end - (current - begin);
+					const skipfield_type *node = scan_end;
+
+					#ifdef PLF_AVX2_SUPPORT
+						for (const __m256i zero = _mm256_setzero_si256(); node - scan_begin >= static_cast<std::ptrdiff_t>(sizeof(__m256i) / sizeof(skipfield_type));)
+						{
+							node -= sizeof(__m256i) / sizeof(skipfield_type);
+							const __m256i nodes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(node));
+							const unsigned int zero_mask = static_cast<unsigned int>(_mm256_movemask_epi8((sizeof(skipfield_type) == 1) ? _mm256_cmpeq_epi8(nodes, zero) : _mm256_cmpeq_epi16(nodes, zero)));
+
+							if (zero_mask != 0xFFFFFFFFu)
+							{
+								return current - ((scan_end - node) - ((highest_set_bit(~zero_mask) / sizeof(skipfield_type)) + 1));
+							}
+						}
+					#endif
+
+					for (const __m128i zero = _mm_setzero_si128(); node - scan_begin >= static_cast<std::ptrdiff_t>(sizeof(__m128i) / sizeof(skipfield_type));)
+					{
+						node -= sizeof(__m128i) / sizeof(skipfield_type);
+						const __m128i nodes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(node));
+						const unsigned int zero_mask = static_cast<unsigned int>(_mm_movemask_epi8((sizeof(skipfield_type) == 1) ? _mm_cmpeq_epi8(nodes, zero) : _mm_cmpeq_epi16(nodes, zero)));
+
+						if (zero_mask != 0xFFFFu)
+						{
+							return current - ((scan_end - node) - ((highest_set_bit(~zero_mask & 0xFFFFu) / sizeof(skipfield_type)) + 1));
+						}
+					}
+
+					current -= scan_end - node;
+				}
+			}
+		#endif
+
+		while (current != begin && *(current - 1) == 0)
+		{
+			--current;
+		}
+
+		return current;
+	}
+
+
+
+	// Moves skipfield_pointer forward by up to distance non-erased elements, where skipfield_pointer points to a non-erased element's node and endpoint is the node corresponding to the group's last_endpoint. Reaching endpoint counts as one step, as it does for ++ moving to the first element of the next group. Returns the remaining distance, which is only non-zero if endpoint was reached:
+	static difference_type advance_skipfield(skipfield_pointer_type &skipfield_pointer, const skipfield_pointer_type endpoint, difference_type distance) PLF_NOEXCEPT
+	{
+		while (true)
+		{
+			const skipfield_pointer_type run_begin = skipfield_pointer + 1;
+			const skipfield_pointer_type run_end = find_skipblock(run_begin, endpoint);
+			const difference_type run_length = run_end - run_begin;
+
+			if (distance <= run_length)
+			{
+				skipfield_pointer += distance;
+				return 0;
+			}
+
+			distance -= run_length + 1;
+			skipfield_pointer = (run_end == endpoint) ? endpoint : run_end + *run_end; // Jump over the skipblock
+
+			if (skipfield_pointer == endpoint || distance == 0)
+			{
+				return distance;
+			}
+		}
+	}
+
+
+
+	// Moves skipfield_pointer backward by up to distance non-erased elements, not moving past beginning_point (the first non-erased element's node in the group). Returns the remaining distance, which is only non-zero if beginning_point was reached:
+	static difference_type retreat_skipfield(skipfield_pointer_type &skipfield_pointer, const skipfield_pointer_type beginning_point, difference_type distance) PLF_NOEXCEPT
+	{
+		while (skipfield_pointer != beginning_point)
+		{
+			const skipfield_pointer_type run_begin = find_skipblock_reverse(beginning_point, skipfield_pointer);
+			const difference_type run_length = skipfield_pointer - run_begin;
+
+			if (distance <= run_length)
+			{
+				skipfield_pointer -= distance;
+				return 0;
+			}
+
+			distance -= run_length;
+			skipfield_pointer = run_begin;
+
+			if (skipfield_pointer == beginning_point)
+			{
+				break;
+			}
+
+			--skipfield_pointer; // The end node of the preceding skipblock
+			skipfield_pointer -= *skipfield_pointer;
+
+			if (--distance == 0)
+			{
+				break;
+			}
+		}
+
+		return distance;
+	}
+
+
+
+	// Returns the number of non-erased elements between current (a non-erased element's node) and end, processing each run of non-erased elements in one go:
+	static difference_type count_skipfield(skipfield_pointer_type current, const skipfield_pointer_type end) PLF_NOEXCEPT
+	{
+		difference_type count = 0;
+
+		while (current != end)
+		{
+			const skipfield_pointer_type run_end = find_skipblock(current, end);
+			count += run_end - current;
+
+			if (run_end == end)
+			{
+				break;
+			}
+
+			current = run_end + *run_end;
+		}
+
+		return count;
+	}
+
+
+
 public:
 
 
@@ -755,7 +1121,7 @@ public:
 				{
 					const difference_type distance_from_end = static_cast<difference_type>(group_pointer->last_endpoint - element_pointer);
 
-					if (group_pointer->size == static_cast<skipfield_type>(distance_from_end)) // ie. if there are no erasures in the group (using endpoint - elements_start to determine number of elements in group just in case this is the last group of the colony, in which case group->last_endpoint != group->elements + group->capacity)
+					if (group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. if there are no erasures in the group. Note: comparing size against distance_from_end is insufficient here, as erasures before and after the iterator can cancel out
 					{
 						if (distance < distance_from_end)
 						{
@@ -778,21 +1144,12 @@ public:
 					{
 						const skipfield_pointer_type endpoint = skipfield_pointer + distance_from_end;
 
-						while(true)
-						{
-							++skipfield_pointer;
-							skipfield_pointer += *skipfield_pointer;
-							--distance;
+						distance = advance_skipfield(skipfield_pointer, endpoint, distance);
 
-							if (skipfield_pointer == endpoint)
-							{
-								break;
-							}
-							else if (distance == 0)
-							{
-								element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
-								return;
-							}
+						if (skipfield_pointer != endpoint)
+						{
+							element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
+							return;
 						}
 
 						if (group_pointer->next_group == NULL) // either we've reached end() or gone beyond it, so bound to end()
@@ -846,12 +1203,7 @@ public:
 				else	 // ie. size > distance - safe to ignore endpoint check condition while incrementing:
 				{
 					skipfield_pointer = group_pointer->skipfield + *(group_pointer->skipfield);
-
-					do
-					{
-						++skipfield_pointer;
-						skipfield_pointer += *skipfield_pointer;
-					} while(--distance != 0);
+					advance_skipfield(skipfield_pointer, group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements), distance);
 
 					element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
 					return;
@@ -893,16 +1245,12 @@ public:
 					{
 						const skipfield_pointer_type beginning_point = group_pointer->skipfield + *(group_pointer->skipfield);
 
-						while(skipfield_pointer != beginning_point)
-						{
-							--skipfield_pointer;
-							skipfield_pointer -= *skipfield_pointer;
+						distance = retreat_skipfield(skipfield_pointer, beginning_point, distance);
 
-							if (--distance == 0)
-							{
-								element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
-								return;
-							}
+						if (distance == 0)
+						{
+							element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
+							return;
 						}
 
 						if (group_pointer->previous_group == NULL)
@@ -941,19 +1289,14 @@ public:
 				}
 				else if (group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. no erased elements in this group
 				{
-					element_pointer = reinterpret_cast<aligned_pointer_type>(group_pointer->skipfield) - distance;
-					skipfield_pointer = (group_pointer->skipfield + group_pointer->capacity) - distance;
+					element_pointer = group_pointer->last_endpoint - distance; // last_endpoint rather than the end of the group's capacity, as iterator may have been end() in a partially-filled back group
+					skipfield_pointer = (group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements)) - distance;
 					return;
 				}
 				else // ie. no more groups to traverse but there are erased elements in this group
 				{
-					skipfield_pointer = group_pointer->skipfield + group_pointer->capacity;
-
-					do
-					{
-						--skipfield_pointer;
-						skipfield_pointer -= *skipfield_pointer;
-					} while(--distance != 0);
+					skipfield_pointer = group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements);
+					retreat_skipfield(skipfield_pointer, group_pointer->skipfield + *(group_pointer->skipfield), distance);
 
 					element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
 					return;
@@ -1009,12 +1352,7 @@ public:
 				{
 					const skipfield_pointer_type endpoint = iterator1.skipfield_pointer + (iterator1.group_pointer->last_endpoint - iterator1.element_pointer);
 
-					while (iterator1.skipfield_pointer != endpoint)
-					{
-						++iterator1.skipfield_pointer;
-						iterator1.skipfield_pointer += *iterator1.skipfield_pointer;
-						++distance;
-					}
+					distance += 1 + count_skipfield(iterator1.skipfield_pointer + 1, endpoint); // Counting from the next node, as iterator1 may be rend()'s position, whose node is not part of the skipfield
 				}
 
 				// Process all other intermediate groups:
@@ -1026,7 +1364,7 @@ public:
 					iterator1.group_pointer = iterator1.group_pointer->next_group;
 				}
 
-				iterator1.skipfield_pointer = iterator1.group_pointer->skipfield;
+				iterator1.skipfield_pointer = iterator1.group_pointer->skipfield + *(iterator1.group_pointer->skipfield); // ie. first non-erased element in group
 			}
 
 
@@ -1034,18 +1372,13 @@ public:
 			{
 				distance += iterator2.skipfield_pointer - iterator1.skipfield_pointer;
 			}
-			else if (iterator2.group_pointer->last_endpoint - 1 >= iterator2.element_pointer || iterator2.element_pointer + *(iterator2.skipfield_pointer + 1) == iterator2.group_pointer->last_endpoint) // ie. if iterator2 is .end() or the last element in the block
+			else if (iterator2.element_pointer == iterator2.group_pointer->last_endpoint && iterator1.skipfield_pointer == iterator1.group_pointer->skipfield + *(iterator1.group_pointer->skipfield)) // ie. if the range covers the whole group
 			{
-				distance += static_cast<difference_type>(iterator2.group_pointer->size) - (iterator2.group_pointer->last_endpoint - iterator2.element_pointer);
+				distance += static_cast<difference_type>(iterator2.group_pointer->size);
 			}
-			else
+			else if (iterator1.skipfield_pointer != iterator2.skipfield_pointer)
 			{
-				while (iterator1.skipfield_pointer != iterator2.skipfield_pointer)
-				{
-					++iterator1.skipfield_pointer;
-					iterator1.skipfield_pointer += *iterator1.skipfield_pointer;
-					++distance;
-				}
+				distance += 1 + count_skipfield(iterator1.skipfield_pointer + 1, iterator2.skipfield_pointer);
 			}
 
 
@@ -1214,7 +1547,7 @@ public:
 				element_pointer -= static_cast<size_type>(*(--skipfield_pointer)) + 1u;
 				skipfield_pointer -= *skipfield_pointer;
 
-				if (!(element_pointer == group_pointer->elements - 1 && group_pointer->previous_group == NULL)) // ie. iterator is not == rend()
+				if (element_pointer != group_pointer->elements - 1) // ie. skipfield did not take us to the start of the group (with some preceding consecutive erased elements)
 				{
 					return *this;
 				}
@@ -1229,8 +1562,8 @@ public:
 			}
 			else // necessary so that reverse_iterator can end up == rend(), if we were already at first element in colony
 			{
-				--element_pointer;
-				--skipfield_pointer;
+				element_pointer = group_pointer->elements - 1;
+				skipfield_pointer = group_pointer->skipfield - 1;
 			}
 
 			return *this;
@@ -1431,16 +1764,12 @@ public:
 				{
 					const skipfield_pointer_type beginning_point = group_pointer->skipfield + *(group_pointer->skipfield);
 
-					while(skipfield_pointer != beginning_point)
-					{
-						--skipfield_pointer;
-						skipfield_pointer -= *skipfield_pointer;
+					distance = retreat_skipfield(skipfield_pointer, beginning_point, distance);
 
-						if (--distance == 0)
-						{
-							element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
-							return;
-						}
+					if (distance == 0)
+					{
+						element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
+						return;
 					}
 
 					if (group_pointer->previous_group == NULL)
@@ -1485,12 +1814,7 @@ public:
 				else
 				{
 					skipfield_pointer = group_pointer->skipfield + group_pointer->capacity;
-
-					do
-					{
-						--skipfield_pointer;
-						skipfield_pointer -= *skipfield_pointer;
-					} while(--distance != 0);
+					retreat_skipfield(skipfield_pointer, group_pointer->skipfield + *(group_pointer->skipfield), distance);
 
 					element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
 					return;
@@ -1527,21 +1851,12 @@ public:
 					{
 						const skipfield_pointer_type endpoint = skipfield_pointer + (group_pointer->last_endpoint - element_pointer);
 
-						while(true)
-						{
-							++skipfield_pointer;
-							skipfield_pointer += *skipfield_pointer;
-							--distance;
+						distance = advance_skipfield(skipfield_pointer, endpoint, distance);
 
-							if (skipfield_pointer == endpoint)
-							{
-								break;
-							}
-							else if (distance == 0)
-							{
-								element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
-								return;
-							}
+						if (skipfield_pointer != endpoint)
+						{
+							element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
+							return;
 						}
 
 						if (group_pointer->next_group == NULL) // bound to rbegin()
@@ -1598,12 +1913,7 @@ public:
 				else // ie. size > distance - safe to ignore endpoint check condition while incrementing:
 				{
 					skipfield_pointer = group_pointer->skipfield + *(group_pointer->skipfield);
-
-					do
-					{
-						++skipfield_pointer;
-						skipfield_pointer += *skipfield_pointer;
-					} while(--distance != 0);
+					advance_skipfield(skipfield_pointer, group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements), distance);
 
 					element_pointer = group_pointer->elements + (skipfield_pointer - group_pointer->skipfield);
 					return;
@@ -1659,19 +1969,39 @@ private:
 	struct ebco_pair2 : tuple_allocator_type // Packaging the element pointer allocator with a lesser-used member variable, for empty-base-class optimisation
 	{
 		skipfield_type min_group_capacity;
-		explicit ebco_pair2(const skipfield_type min_elements) PLF_NOEXCEPT: min_group_capacity(min_elements) {}
+		ebco_pair2(const skipfield_type min_elements, const allocator_type &alloc) PLF_NOEXCEPT: tuple_allocator_type(alloc), min_group_capacity(min_elements) {}
 	}							tuple_allocator_pair;
 
 	struct ebco_pair : group_allocator_type
 	{
 		skipfield_type max_group_capacity;
-		explicit ebco_pair(const skipfield_type max_elements) PLF_NOEXCEPT: max_group_capacity(max_elements) {}
+		ebco_pair(const skipfield_type max_elements, const allocator_type &alloc) PLF_NOEXCEPT: group_allocator_type(alloc), max_group_capacity(max_elements) {}
 	}							group_allocator_pair;
 
+	struct reuse_counter // Element locations reused since the growth policy was last called. 32-bit so that it fits alongside the block capacity limits rather than enlarging the colony
+	{
+		unsigned int count;
+		reuse_counter(const unsigned int initial = 0) PLF_NOEXCEPT: count(initial) {}
+	}							growth_reuses;
 
+	struct growth_policy_holder
+	{
+		plf::colony_growth_policy policy;
+		growth_policy_holder(const plf::colony_growth_policy growth_policy = NULL) PLF_NOEXCEPT: policy(growth_policy) {}
+	}							growth_function;
 
-	// An adaptive minimum based around sizeof(element_type), sizeof(group) and sizeof(colony):
-	#define PLF_MIN_BLOCK_CAPACITY (sizeof(aligned_element_type) * 8 > (sizeof(plf::colony<element_type>) + sizeof(group)) * 2) ? 8 : (((sizeof(plf::colony<element_type>) + sizeof(group)) * 2) / sizeof(aligned_element_type))
+	#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+		struct allocation_counter_set // Belongs to the colony object, not its contents - ie. not transferred by move or swap
+		{
+			size_type group_allocations, group_deallocations, group_recycles;
+			allocation_counter_set() PLF_NOEXCEPT: group_allocations(0), group_deallocations(0), group_recycles(0) {}
+		}							allocation_counters;
+	#endif
+
+
+
+	// An adaptive minimum based around sizeof(element_type), sizeof(group) and sizeof(colony):
+	#define PLF_MIN_BLOCK_CAPACITY (sizeof(aligned_element_type) * 8 > (sizeof(plf::colony<element_type>) + sizeof(group)) * 2) ? 8 : (((sizeof(plf::colony<element_type>) + sizeof(group)) * 2) / sizeof(aligned_element_type))
 
 
 
@@ -1703,8 +2033,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
-		group_allocator_pair(std::numeric_limits<skipfield_type>::max())
+		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY, *this),
+		group_allocator_pair(std::numeric_limits<skipfield_type>::max(), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1719,8 +2049,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+		group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1738,8 +2068,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
-		group_allocator_pair(std::numeric_limits<skipfield_type>::max())
+		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY, *this),
+		group_allocator_pair(std::numeric_limits<skipfield_type>::max(), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1754,8 +2084,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+		group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1773,10 +2103,12 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size))), // min group size is set to value closest to total number of elements in source colony in order to not create unnecessary small groups in the range-insert below, then reverts to the original min group size afterwards. This effectively saves a call to reserve.
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size)), *this), // min group size is set to value closest to total number of elements in source colony in order to not create unnecessary small groups in the range-insert below, then reverts to the original min group size afterwards. This effectively saves a call to reserve.
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity, *this),
+		growth_function(source.growth_function)
 	{ // can skip checking for skipfield conformance here as the skipfields must be equal between the destination and source, and source will have already had theirs checked. Same applies for other copy and move constructors below
 		range_assign(source.begin_iterator, source.total_size);
+		copy_cold_values(source);
 		tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity; // reset to correct value for future operations
 	}
 
@@ -1790,10 +2122,12 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size))),
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size)), *this),
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity, *this),
+		growth_function(source.growth_function)
 	{
 		range_assign(source.begin_iterator, source.total_size);
+		copy_cold_values(source);
 		tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity;
 	}
 
@@ -1806,7 +2140,7 @@ private:
 		#ifdef PLF_TYPE_TRAITS_SUPPORT
 			if PLF_CONSTEXPR (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value)	// if all pointer types are trivial, we can just nuke it from orbit with memset (NULL is always 0 in C++):
 			{
-				std::memset(static_cast<void *>(this), 0, offsetof(colony, tuple_allocator_pair));
+				std::memset(static_cast<void *>(&end_iterator), 0, static_cast<size_t>(reinterpret_cast<char *>(&tuple_allocator_pair) - reinterpret_cast<char *>(&end_iterator))); // Starts from the first member rather than this, so as not to overwrite a stateful allocator base
 			}
 			else
 		#endif
@@ -1839,8 +2173,10 @@ public:
 			unused_groups_head(std::move(source.unused_groups_head)),
 			total_size(source.total_size),
 			total_capacity(source.total_capacity),
-			tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
-			group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+			tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity, *this),
+			group_allocator_pair(source.group_allocator_pair.max_group_capacity, *this),
+			growth_reuses(source.growth_reuses),
+			growth_function(source.growth_function)
 		{
 			assert(&source != this);
 			source.blank();
@@ -1858,8 +2194,10 @@ public:
 			unused_groups_head(std::move(source.unused_groups_head)),
 			total_size(source.total_size),
 			total_capacity(source.total_capacity),
-			tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
-			group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+			tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity, *this),
+			group_allocator_pair(source.group_allocator_pair.max_group_capacity, *this),
+			growth_reuses(source.growth_reuses),
+			growth_function(source.growth_function)
 		{
 			assert(&source != this);
 			source.blank();
@@ -1876,8 +2214,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+		group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1896,8 +2234,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+		group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1917,8 +2255,8 @@ public:
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+		group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 	{
 		#ifndef PLF_ALIGNMENT_SUPPORT
 			check_skipfield_conformance();
@@ -1940,8 +2278,8 @@ public:
 			unused_groups_head(NULL),
 			total_size(0),
 			total_capacity(0),
-			tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-			group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+			tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+			group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 		{
 			#ifndef PLF_ALIGNMENT_SUPPORT
 				check_skipfield_conformance();
@@ -1962,8 +2300,8 @@ public:
 			unused_groups_head(NULL),
 			total_size(0),
 			total_capacity(0),
-			tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-			group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+			tuple_allocator_pair(static_cast<skipfield_type>(capacities.min), *this),
+			group_allocator_pair(static_cast<skipfield_type>(capacities.max), *this)
 		{
 			#ifndef PLF_ALIGNMENT_SUPPORT
 				check_skipfield_conformance();
@@ -2027,7 +2365,7 @@ public:
 
 	inline reverse_iterator rend() PLF_NOEXCEPT
 	{
-		return reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (begin_iterator.group_pointer != NULL) ? reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1, begin_iterator.group_pointer->skipfield - 1) : reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1); // The start of the group rather than begin() - 1, as begin() may not be the first element in the group if preceding elements have been erased, and reverse_iterator ++ always stops at the group start
 	}
 
 
@@ -2041,7 +2379,7 @@ public:
 
 	inline const_reverse_iterator crend() const PLF_NOEXCEPT
 	{
-		return const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (begin_iterator.group_pointer != NULL) ? const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1, begin_iterator.group_pointer->skipfield - 1) : const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1); // The start of the group rather than begin() - 1, as begin() may not be the first element in the group if preceding elements have been erased, and reverse_iterator ++ always stops at the group start
 	}
 
 
@@ -2059,13 +2397,14 @@ private:
 	group_pointer_type allocate_new_group(const skipfield_type elements_per_group, group_pointer_type const previous = NULL)
 	{
 		group_pointer_type const new_group = PLF_ALLOCATE(group_allocator_type, group_allocator_pair, 1, 0);
+		const aligned_struct_allocator_type struct_allocator(*this); // Groups allocate their element blocks with a copy of the colony's allocator, so that stateful allocators are respected
 
 		try
 		{
 			#ifdef PLF_VARIADICS_SUPPORT
-				PLF_CONSTRUCT(group_allocator_type, group_allocator_pair, new_group, elements_per_group, previous);
+				PLF_CONSTRUCT(group_allocator_type, group_allocator_pair, new_group, struct_allocator, elements_per_group, previous);
 			#else
-				PLF_CONSTRUCT(group_allocator_type, group_allocator_pair, new_group, group(elements_per_group, previous));
+				PLF_CONSTRUCT(group_allocator_type, group_allocator_pair, new_group, group(struct_allocator, elements_per_group, previous));
 			#endif
 		}
 		catch (...)
@@ -2074,6 +2413,10 @@ private:
 			throw;
 		}
 
+		#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+			++allocation_counters.group_allocations;
+		#endif
+
 		return new_group;
 	}
 
@@ -2083,10 +2426,73 @@ private:
 	{
 		PLF_DESTROY(group_allocator_type, group_allocator_pair, the_group);
 		PLF_DEALLOCATE(group_allocator_type, group_allocator_pair, the_group, 1);
+
+		#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+			++allocation_counters.group_deallocations;
+		#endif
+	}
+
+
+
+	// The capacity of the next group allocated by a single insert - by default the colony's size, doubling total capacity, otherwise as chosen by the growth policy:
+	skipfield_type next_group_capacity()
+	{
+		size_type capacity = total_size;
+
+		if (growth_function.policy != NULL)
+		{
+			plf::colony_growth_state state;
+			state.size = total_size;
+			state.capacity = total_capacity;
+			state.back_group_capacity = end_iterator.group_pointer->capacity;
+			state.reuses = growth_reuses.count;
+			state.min_capacity = tuple_allocator_pair.min_group_capacity;
+			state.max_capacity = group_allocator_pair.max_group_capacity;
+
+			capacity = static_cast<size_type>(growth_function.policy(state));
+			growth_reuses.count = 0;
+
+			if (capacity < tuple_allocator_pair.min_group_capacity)
+			{
+				capacity = tuple_allocator_pair.min_group_capacity;
+			}
+		}
+
+		return (capacity < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(capacity) : group_allocator_pair.max_group_capacity;
+	}
+
+
+
+	inline void count_group_recycle(const group_pointer_type recycled_group) PLF_NOEXCEPT
+	{
+		if (growth_function.policy != NULL)
+		{
+			growth_reuses.count += recycled_group->capacity;
+		}
+
+		#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+			++allocation_counters.group_recycles;
+		#endif
 	}
 
 
 
+	// Used when a temporary colony's groups have been swapped into this one - destroys the temporary's contents and takes on its counts, so that the counts reflect this colony's lifetime:
+	#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+		void absorb_allocation_counters(colony &temporary) PLF_NOEXCEPT
+		{
+			temporary.destroy_all_data();
+			temporary.blank();
+			allocation_counters.group_allocations += temporary.allocation_counters.group_allocations;
+			allocation_counters.group_deallocations += temporary.allocation_counters.group_deallocations;
+			allocation_counters.group_recycles += temporary.allocation_counters.group_recycles;
+		}
+	#else
+		inline void absorb_allocation_counters(colony &) PLF_NOEXCEPT {}
+	#endif
+
+
+
 	void destroy_all_data() PLF_NOEXCEPT
 	{
 		if (begin_iterator.group_pointer != NULL)
@@ -2148,6 +2554,11 @@ private:
 
 	void update_skipblock(const iterator &new_location, const skipfield_type prev_free_list_index) PLF_NOEXCEPT
 	{
+		if (growth_function.policy != NULL) // Reuses are only needed by a growth policy
+		{
+			++growth_reuses.count;
+		}
+
 		const skipfield_type new_value = static_cast<skipfield_type>(*(new_location.skipfield_pointer) - 1);
 
 		if (new_value != 0) // ie. skipfield was not 1, ie. a single-node skipblock, with no additional nodes to update
@@ -2238,7 +2649,7 @@ public:
 
 				if (unused_groups_head == NULL)
 				{
-					const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+					const skipfield_type new_group_size = next_group_capacity();
 					next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
 					#ifdef PLF_TYPE_TRAITS_SUPPORT
@@ -2267,6 +2678,7 @@ public:
 					next_group = unused_groups_head;
 					PLF_CONSTRUCT(allocator_type, *this, reinterpret_cast<pointer>(next_group->elements), element);
 					unused_groups_head = next_group->next_group;
+					count_group_recycle(next_group);
 					next_group->reset(1, NULL, end_iterator.group_pointer, end_iterator.group_pointer->group_number + 1u);
 				}
 
@@ -2356,7 +2768,7 @@ public:
 
 					if (unused_groups_head == NULL)
 					{
-						const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+						const skipfield_type new_group_size = next_group_capacity();
 						next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
 						#ifdef PLF_TYPE_TRAITS_SUPPORT
@@ -2385,6 +2797,7 @@ public:
 						next_group = unused_groups_head;
 						PLF_CONSTRUCT(allocator_type, *this, reinterpret_cast<pointer>(next_group->elements), std::move(element));
 						unused_groups_head = next_group->next_group;
+						count_group_recycle(next_group);
 						next_group->reset(1, NULL, end_iterator.group_pointer, end_iterator.group_pointer->group_number + 1u);
 					}
 
@@ -2475,7 +2888,7 @@ public:
 
 					if (unused_groups_head == NULL)
 					{
-						const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+						const skipfield_type new_group_size = next_group_capacity();
 						next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
 						#ifdef PLF_TYPE_TRAITS_SUPPORT
@@ -2504,6 +2917,7 @@ public:
 						next_group = unused_groups_head;
 						PLF_CONSTRUCT(allocator_type, *this, reinterpret_cast<pointer>(next_group->elements), std::forward<arguments>(parameters) ...);
 						unused_groups_head = next_group->next_group;
+						count_group_recycle(next_group);
 						next_group->reset(1, NULL, end_iterator.group_pointer, end_iterator.group_pointer->group_number + 1u);
 					}
 
@@ -2666,6 +3080,11 @@ private:
 
 	void fill_skipblock(const element_type &element, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
 	{
+		if (growth_function.policy != NULL)
+		{
+			growth_reuses.count += size;
+		}
+
 		#ifdef PLF_TYPE_TRAITS_SUPPORT
 			if PLF_CONSTEXPR (std::is_nothrow_copy_constructible<element_type>::value)
 			{
@@ -2728,6 +3147,7 @@ private:
 		{
 			const skipfield_type capacity = end_iterator.group_pointer->capacity;
 			end_iterator.group_pointer->reset(capacity, end_iterator.group_pointer->next_group, previous_group, group_number++);
+			count_group_recycle(end_iterator.group_pointer);
 			previous_group = end_iterator.group_pointer;
 			size -= static_cast<size_type>(capacity);
 			end_iterator.element_pointer = end_iterator.group_pointer->elements;
@@ -2737,6 +3157,7 @@ private:
 		// Deal with final group (partial fill)
 		unused_groups_head = end_iterator.group_pointer->next_group;
 		end_iterator.group_pointer->reset(static_cast<skipfield_type>(size), NULL, previous_group, group_number);
+		count_group_recycle(end_iterator.group_pointer);
 		end_iterator.element_pointer = end_iterator.group_pointer->elements;
 		end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + size;
 		fill(element, static_cast<skipfield_type>(size));
@@ -2899,6 +3320,11 @@ private:
 	template <class iterator_type>
 	iterator_type range_fill_skipblock(iterator_type it, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
 	{
+		if (growth_function.policy != NULL)
+		{
+			growth_reuses.count += size;
+		}
+
 		const aligned_pointer_type fill_end = location + size;
 
 		#ifdef PLF_TYPE_TRAITS_SUPPORT
@@ -2946,6 +3372,7 @@ private:
 		{
 			const skipfield_type capacity = end_iterator.group_pointer->capacity;
 			end_iterator.group_pointer->reset(capacity, end_iterator.group_pointer->next_group, previous_group, group_number++);
+			count_group_recycle(end_iterator.group_pointer);
 			previous_group = end_iterator.group_pointer;
 			size -= static_cast<size_type>(capacity);
 			end_iterator.element_pointer = end_iterator.group_pointer->elements;
@@ -2955,6 +3382,7 @@ private:
 		// Deal with final group (partial fill)
 		unused_groups_head = end_iterator.group_pointer->next_group;
 		end_iterator.group_pointer->reset(static_cast<skipfield_type>(size), NULL, previous_group, group_number);
+		count_group_recycle(end_iterator.group_pointer);
 		end_iterator.element_pointer = end_iterator.group_pointer->elements;
 		end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + size;
 		range_fill(it, static_cast<skipfield_type>(size));
@@ -3172,6 +3600,47 @@ private:
 
 
 
+	// Used by erase for a group which has become empty and is not being retained. Generational colonies always retain the group instead, so that handles to its elements stay checkable:
+	inline void remove_group(group_pointer_type const the_group) PLF_NOEXCEPT
+	{
+		if PLF_CONSTEXPR (generational)
+		{
+			add_group_to_unused_groups_list(the_group);
+		}
+		else
+		{
+			total_capacity -= the_group->capacity;
+			deallocate_group(the_group);
+		}
+	}
+
+
+
+	// Generational mode only - increments the generation counters of every index in [first, last), erased or not:
+	static void increment_generations(const_iterator first, const const_iterator &last) PLF_NOEXCEPT
+	{
+		while (first.element_pointer != last.element_pointer)
+		{
+			const aligned_pointer_type end = (first.group_pointer == last.group_pointer) ? last.element_pointer : first.group_pointer->last_endpoint;
+			generation_type * const generations = first.group_pointer->generations();
+
+			for (size_type index = static_cast<size_type>(first.element_pointer - first.group_pointer->elements), end_index = static_cast<size_type>(end - first.group_pointer->elements); index != end_index; ++index)
+			{
+				++generations[index];
+			}
+
+			if (first.group_pointer == last.group_pointer)
+			{
+				return;
+			}
+
+			first.group_pointer = first.group_pointer->next_group;
+			first.element_pointer = first.group_pointer->elements;
+		}
+	}
+
+
+
 public:
 
 	// must return iterator to subsequent non-erased element (or end()), in case the group containing the element which the iterator points to becomes empty after the erasure, and is thereafter removed from the colony chain, making the current iterator invalid and unusable in a ++ operation:
@@ -3189,6 +3658,11 @@ public:
 			PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(it.element_pointer));
 		}
 
+		if PLF_CONSTEXPR (generational)
+		{
+			++*(it.group_pointer->generations() + (it.skipfield_pointer - it.group_pointer->skipfield));
+		}
+
 		--total_size;
 
 		if (it.group_pointer->size-- != 1) // ie. non-empty group at this point in time, don't consolidate - optimization note: GCC optimizes postfix - 1 comparison better than prefix - 1 comparison in some cases.
@@ -3328,8 +3802,7 @@ public:
 				remove_from_groups_with_erasures_list(it.group_pointer);
 			}
 
-			total_capacity -= it.group_pointer->capacity;
-			deallocate_group(it.group_pointer);
+			remove_group(it.group_pointer);
 
 			// note: end iterator only needs to be changed if the deleted group was the final group in the chain ie. not in this case
 			begin_iterator.element_pointer = begin_iterator.group_pointer->elements + *(begin_iterator.group_pointer->skipfield); // If the beginning index has been erased (ie. skipfield != 0), skip to next non-erased element
@@ -3351,8 +3824,7 @@ public:
 
 			if (it.group_pointer->next_group != end_iterator.group_pointer)
 			{
-				total_capacity -= it.group_pointer->capacity;
-				deallocate_group(it.group_pointer);
+				remove_group(it.group_pointer);
 			}
 			else
 			{
@@ -3388,6 +3860,11 @@ public:
 	{
 		assert(iterator1 <= iterator2);
 
+		if PLF_CONSTEXPR (generational)
+		{
+			increment_generations(iterator1, iterator2);
+		}
+
 		const_iterator current = iterator1;
 
 		if (current.group_pointer != iterator2.group_pointer) // ie. if start and end iterators are in separate groups
@@ -3411,18 +3888,24 @@ public:
 				{
 					while (current.element_pointer != end)
 					{
-						if (*current.skipfield_pointer == 0)
+						if (*current.skipfield_pointer == 0) // Erase the whole run of non-erased elements up to the next skipblock in one go
 						{
+							const skipfield_pointer_type run_end = find_skipblock(current.skipfield_pointer, current.skipfield_pointer + (end - current.element_pointer));
+							const aligned_pointer_type run_element_end = current.element_pointer + (run_end - current.skipfield_pointer);
+							number_of_group_erasures += static_cast<size_type>(run_end - current.skipfield_pointer);
+
 							#ifdef PLF_TYPE_TRAITS_SUPPORT
 								if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
 							#endif
 							{
-								PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
+								while (current.element_pointer != run_element_end)
+								{
+									PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer++));
+								}
 							}
 
-							++number_of_group_erasures;
-							++current.element_pointer;
-							++current.skipfield_pointer;
+							current.element_pointer = run_element_end;
+							current.skipfield_pointer = run_end;
 						}
 						else // remove skipblock from group:
 						{
@@ -3539,8 +4022,7 @@ public:
 
 				if (current_group != end_iterator.group_pointer && current_group->next_group != end_iterator.group_pointer)
 				{
-					total_capacity -= current_group->capacity;
-					deallocate_group(current_group);
+					remove_group(current_group);
 				}
 				else
 				{
@@ -3589,18 +4071,24 @@ public:
 			{
 				while (current.element_pointer != iterator2.element_pointer)
 				{
-					if (*current.skipfield_pointer == 0)
+					if (*current.skipfield_pointer == 0) // Erase the whole run of non-erased elements up to the next skipblock in one go
 					{
+						const skipfield_pointer_type run_end = find_skipblock(current.skipfield_pointer, current.skipfield_pointer + (iterator2.element_pointer - current.element_pointer));
+						const aligned_pointer_type run_element_end = current.element_pointer + (run_end - current.skipfield_pointer);
+						number_of_group_erasures += static_cast<size_type>(run_end - current.skipfield_pointer);
+
 						#ifdef PLF_TYPE_TRAITS_SUPPORT
 							if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
 						#endif
 						{
-							PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
+							while (current.element_pointer != run_element_end)
+							{
+								PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer++));
+							}
 						}
 
-						++number_of_group_erasures;
-						++current.element_pointer;
-						++current.skipfield_pointer;
+						current.element_pointer = run_element_end;
+						current.skipfield_pointer = run_end;
 					}
 					else // remove skipblock from group:
 					{
@@ -3728,7 +4216,7 @@ public:
 					begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield + skip;
 				}
 
-				if (current.group_pointer->next_group != end_iterator.group_pointer)
+				if (!generational && current.group_pointer->next_group != end_iterator.group_pointer)
 				{
 					total_capacity -= current.group_pointer->capacity;
 				}
@@ -3755,705 +4243,2127 @@ public:
 
 private:
 
-	void prepare_groups_for_assign(const size_type size)
+	// Single-pass group erasure, used by erase_if and erasure_queue. The pass walks a group's skipfield, jumping over existing skipblocks and asking the selector about each non-erased element. Selected elements are destroyed and merged with any adjacent skipblocks, and each resulting skipblock is written out and added to a newly-built free list as soon as it ends:
+	struct group_erasure_state
 	{
-		// Destroy all elements if non-trivial:
-		#ifdef PLF_TYPE_TRAITS_SUPPORT
-			if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
-		#endif
+		skipfield_type index, run_length, free_list_head, number_erased;
+
+		group_erasure_state() PLF_NOEXCEPT:
+			index(0),
+			run_length(0),
+			free_list_head(std::numeric_limits<skipfield_type>::max()),
+			number_erased(0)
+		{}
+	};
+
+
+
+	struct select_none
+	{
+		inline bool operator() (const aligned_pointer_type) const PLF_NOEXCEPT
 		{
-			for (iterator current = begin_iterator; current != end_iterator; ++current)
-			{
-				PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
-			}
+			return false;
 		}
+	};
 
-		if (size < total_capacity && (total_capacity - size) >= tuple_allocator_pair.min_group_capacity)
-		{
-			size_type difference = total_capacity - size;
-			end_iterator.group_pointer->next_group = unused_groups_head;
 
-			// Remove surplus groups which're under the difference limit:
-			group_pointer_type current_group = begin_iterator.group_pointer, previous_group = NULL;
 
-			do
-			{
-				const group_pointer_type next_group = current_group->next_group;
+	template <class selector_type>
+	void erasure_pass(const group_pointer_type group_p, group_erasure_state &state, selector_type &select)
+	{
+		const skipfield_pointer_type group_skipfield = group_p->skipfield;
+		const skipfield_type end_index = static_cast<skipfield_type>(group_p->last_endpoint - group_p->elements);
 
-				if (current_group->capacity <= difference)
-				{ // Remove group:
-					difference -= current_group->capacity;
-					total_capacity -= current_group->capacity;
-					deallocate_group(current_group);
+		while (true)
+		{
+			if (state.index != end_index && group_skipfield[state.index] != 0) // existing skipblock - only start nodes are visited, as whole skipblocks are jumped over
+			{
+				state.run_length = static_cast<skipfield_type>(state.run_length + group_skipfield[state.index]);
+				state.index = static_cast<skipfield_type>(state.index + group_skipfield[state.index]);
+			}
+			else if (state.index != end_index && select(group_p->elements + state.index)) // newly-erased element
+			{
+				#ifdef PLF_TYPE_TRAITS_SUPPORT
+					if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
+				#endif
+				{
+					PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(group_p->elements + state.index));
+				}
 
-					if (current_group == begin_iterator.group_pointer)
-					{
-						begin_iterator.group_pointer = next_group;
-					}
+				if PLF_CONSTEXPR (generational)
+				{
+					++*(group_p->generations() + state.index);
 				}
-				else
+
+				++state.run_length;
+				++state.index;
+				++state.number_erased;
+			}
+			else
+			{
+				if (state.run_length != 0) // Write out the preceding skipblock and add it to the free list:
 				{
-					if (previous_group != NULL)
+					const skipfield_type run_start = static_cast<skipfield_type>(state.index - state.run_length);
+					group_skipfield[run_start] = group_skipfield[state.index - 1] = state.run_length;
+					*(reinterpret_cast<skipfield_pointer_type>(group_p->elements + run_start)) = state.free_list_head;
+					*(reinterpret_cast<skipfield_pointer_type>(group_p->elements + run_start) + 1) = std::numeric_limits<skipfield_type>::max();
+
+					if (state.free_list_head != std::numeric_limits<skipfield_type>::max())
 					{
-						previous_group->next_group = current_group;
+						*(reinterpret_cast<skipfield_pointer_type>(group_p->elements + state.free_list_head) + 1) = run_start;
 					}
 
-					previous_group = current_group;
+					state.free_list_head = run_start;
+					state.run_length = 0;
 				}
 
-				current_group = next_group;
-			} while (current_group != NULL);
+				if (state.index == end_index)
+				{
+					return;
+				}
 
-			previous_group->next_group = NULL;
-		}
-		else
-		{
-			if (size > total_capacity)
-			{
-				reserve(size);
+				++state.index;
 			}
-
-			// Join all unused_groups to main chain:
-			end_iterator.group_pointer->next_group = unused_groups_head;
 		}
-
-		begin_iterator.element_pointer = begin_iterator.group_pointer->elements;
-		begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield;
-		groups_with_erasures_list_head = NULL;
-		total_size = 0;
 	}
 
 
-public:
-
-
-	// Fill assign:
 
-	inline void assign(const size_type size, const element_type &element)
+	// Runs the erasure pass over a group and updates the group's free list head and size. Does not update total_size, begin_iterator or the groups-with-erasures list. If the selector throws, the pass is completed without further erasures before rethrowing, so the group is left valid. Returns the number of elements erased:
+	template <class selector_type>
+	skipfield_type erase_selected_in_group(const group_pointer_type group_p, selector_type &select)
 	{
-		if (size == 0)
+		group_erasure_state state;
+
+		try
 		{
-			reset();
-			return;
+			erasure_pass(group_p, state, select);
 		}
-
-		prepare_groups_for_assign(size);
-		fill_unused_groups(size, element, 0, NULL, begin_iterator.group_pointer);
-	}
-
-
-
-private:
-
-	// Range assign core:
-
-	template <class iterator_type>
-	inline void range_assign(const iterator_type it, const size_type size)
-	{
-		if (size == 0)
+		catch (...)
 		{
-			reset();
-			return;
+			select_none none;
+			erasure_pass(group_p, state, none);
+			group_p->free_list_head = state.free_list_head;
+			group_p->size = static_cast<skipfield_type>(group_p->size - state.number_erased);
+			throw;
 		}
 
-		prepare_groups_for_assign(size);
-		range_fill_unused_groups(size, it, 0, NULL, begin_iterator.group_pointer);
+		group_p->free_list_head = state.free_list_head;
+		group_p->size = static_cast<skipfield_type>(group_p->size - state.number_erased);
+		return state.number_erased;
 	}
 
 
 
+	// Selects the elements pointed to by a sorted range of iterators within one group:
+	struct iterator_selector
+	{
+		const const_iterator *current, *last;
 
-public:
+		iterator_selector(const const_iterator * const first, const const_iterator * const end) PLF_NOEXCEPT: current(first), last(end) {}
 
-	// Range assign:
+		inline bool operator() (const aligned_pointer_type element) PLF_NOEXCEPT
+		{
+			if (current != last && current->element_pointer == element)
+			{
+				++current;
+				return true;
+			}
 
-	template <class iterator_type>
-	inline void assign(const typename plf_enable_if_c<!std::numeric_limits<iterator_type>::is_integer, iterator_type>::type first, const iterator_type last)
-	{
-		using std::distance;
-		range_assign(first, static_cast<size_type>(distance(first,last)));
-	}
+			return false;
+		}
+	};
 
 
 
-	// Range assign for use with sentinels:
+	// Erases the elements pointed to by the sorted, non-duplicate iterators in [first, last), which must all be within the same group and must not be all of the group's elements:
+	void erase_within_group(const const_iterator * const first, const const_iterator * const last) PLF_NOEXCEPT
+	{
+		const group_pointer_type group_p = first->group_pointer;
 
-	#ifdef PLF_CPP20_SUPPORT
-		template <class iterator_type, class sentinel>
-			requires (!(std::convertible_to<sentinel, iterator_type> || std::convertible_to<iterator_type, sentinel> || std::integral<iterator_type> || std::integral<sentinel>) && std::sentinel_for<sentinel, iterator_type>)
-		inline void assign (const iterator_type first, const sentinel last)
+		if (group_p->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. not already in the groups-with-erasures list
 		{
-			size_type distance = 0;
-			for(iterator_type current = first; current != last; ++current, ++distance) {};
-			range_assign(first, distance);
+			group_p->erasures_list_next_group = groups_with_erasures_list_head;
+			groups_with_erasures_list_head = group_p;
 		}
-	#endif
 
+		iterator_selector select(first, last);
+		total_size -= erase_selected_in_group(group_p, select);
 
-
-	// Range assign, move_iterator overload:
-
-	#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-		template <class iterator_type>
-		inline void assign (const std::move_iterator<iterator_type> first, const std::move_iterator<iterator_type> last)
+		if (group_p == begin_iterator.group_pointer)
 		{
-			using std::distance;
-			range_assign(first, static_cast<size_type>(distance(first.base(),last.base())));
+			begin_iterator.element_pointer = group_p->elements + *(group_p->skipfield);
+			begin_iterator.skipfield_pointer = group_p->skipfield + *(group_p->skipfield);
 		}
-	#endif
+	}
 
 
 
-	// Initializer-list assign:
+	// Erases the elements pointed to by the iterators in [first, last), in any order and possibly containing duplicates, one group at a time. The iterator array is sorted in place. Returns the number of elements erased:
+	size_type batch_erase(const_iterator * const first, const_iterator *last)
+	{
+		std::sort(first, last);
+		last = std::unique(first, last);
 
-	#ifdef PLF_INITIALIZER_LIST_SUPPORT
-		inline void assign(const std::initializer_list<element_type> &element_list)
+		for (const_iterator *current = first; current != last;)
 		{
-			range_assign(element_list.begin(), static_cast<size_type>(element_list.size()));
-		}
-	#endif
+			const group_pointer_type group_p = current->group_pointer;
+			const_iterator *group_last = current + 1;
 
+			while (group_last != last && group_last->group_pointer == group_p)
+			{
+				++group_last;
+			}
 
+			if (group_last - current == 1)
+			{
+				erase(*current);
+			}
+			else if (static_cast<size_type>(group_last - current) == group_p->size) // Whole group - range-erase handles group removal
+			{
+				const group_pointer_type next_group = group_p->next_group;
+				const const_iterator group_begin(group_p, group_p->elements + *(group_p->skipfield), group_p->skipfield + *(group_p->skipfield));
+				erase(group_begin, (next_group == NULL) ? static_cast<const_iterator>(end_iterator) : const_iterator(next_group, next_group->elements + *(next_group->skipfield), next_group->skipfield + *(next_group->skipfield)));
+			}
+			else
+			{
+				erase_within_group(current, group_last);
+			}
 
+			current = group_last;
+		}
 
-	#ifdef PLF_CPP20_SUPPORT
-		[[nodiscard]]
-	#endif
-	inline PLF_FORCE_INLINE bool empty() const PLF_NOEXCEPT
-	{
-		return total_size == 0;
+		return static_cast<size_type>(last - first);
 	}
 
 
 
-	inline size_type size() const PLF_NOEXCEPT
+	template <class predicate_function>
+	struct predicate_selector
 	{
-		return total_size;
-	}
+		predicate_function &predicate;
 
+		explicit predicate_selector(predicate_function &function) PLF_NOEXCEPT: predicate(function) {}
 
+		inline bool operator() (const aligned_pointer_type element)
+		{
+			return predicate(*reinterpret_cast<pointer>(element));
+		}
+	};
 
-	inline static PLF_CONSTEXPR size_type block_metadata_memory(const size_type block_capacity)
-	{
-		return sizeof(group) + ((block_capacity + 1) * sizeof(skipfield_type));
-	}
 
 
+	// Used by erase_if once group sizes have been updated - removes emptied groups from the chain, then rebuilds the groups-with-erasures list, group numbers, total_size and the begin and end iterators in one pass:
+	void relink_groups_after_erasure() PLF_NOEXCEPT
+	{
+		group_pointer_type previous_group = NULL;
+		size_type group_number = 0;
+		groups_with_erasures_list_head = NULL;
+		total_size = 0;
 
-	#ifdef PLF_COLONY_TEST_DEBUG // used for debugging during internal testing only:
-		size_type group_size_sum() const PLF_NOEXCEPT
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL;)
 		{
-			size_type temp = 0;
+			const group_pointer_type next_group = current_group->next_group;
 
-			for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+			if (current_group->size == 0)
 			{
-				temp += current->size;
+				if (next_group != NULL)
+				{
+					remove_group(current_group);
+				}
+				else if (previous_group != NULL) // Back group is retained, as per erase()
+				{
+					add_group_to_unused_groups_list(current_group);
+				}
+				else // ie. colony is now empty
+				{
+					begin_iterator.group_pointer = end_iterator.group_pointer = current_group;
+					reset_only_group_left(current_group);
+					return;
+				}
 			}
+			else
+			{
+				if (previous_group == NULL)
+				{
+					begin_iterator.group_pointer = current_group;
+				}
+				else
+				{
+					previous_group->next_group = current_group;
+				}
 
-			return temp;
-		}
-	#endif
-
-
+				current_group->previous_group = previous_group;
+				current_group->group_number = group_number++;
+				total_size += current_group->size;
 
-	inline size_type max_size() const PLF_NOEXCEPT
-	{
-		#ifdef PLF_ALLOCATOR_TRAITS_SUPPORT
-			return std::allocator_traits<allocator_type>::max_size(*this);
-		#else
-			return allocator_type::max_size();
-		#endif
-	}
+				if (current_group->free_list_head != std::numeric_limits<skipfield_type>::max())
+				{
+					current_group->erasures_list_next_group = groups_with_erasures_list_head;
+					groups_with_erasures_list_head = current_group;
+				}
 
+				previous_group = current_group;
+			}
 
+			current_group = next_group;
+		}
 
-	inline size_type capacity() const PLF_NOEXCEPT
-	{
-		return total_capacity;
+		previous_group->next_group = NULL;
+		end_iterator.group_pointer = previous_group;
+		end_iterator.element_pointer = previous_group->last_endpoint;
+		end_iterator.skipfield_pointer = previous_group->skipfield + (previous_group->last_endpoint - previous_group->elements);
+		begin_iterator.element_pointer = begin_iterator.group_pointer->elements + *(begin_iterator.group_pointer->skipfield);
+		begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield + *(begin_iterator.group_pointer->skipfield);
 	}
 
 
 
-	inline size_type memory() const PLF_NOEXCEPT
+public:
+
+	// Erases all elements for which predicate(element) returns true, evaluating the predicate once per element, in iteration order. Each group is processed in a single pass which rewrites its skipblocks and free list, and emptied groups are removed in bulk afterwards. If the predicate throws, elements already erased stay erased and the colony remains valid. Returns the number of elements erased:
+	template <class predicate_function>
+	size_type erase_if(predicate_function predicate)
 	{
-		size_type memory_use = sizeof(*this); // sizeof colony basic structure
-		end_iterator.group_pointer->next_group = unused_groups_head; // temporarily link the main groups and unused groups (reserved groups) in order to only have one loop below instead of several
+		if (total_size == 0)
+		{
+			return 0;
+		}
 
-		for(group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+		const size_type original_size = total_size;
+		predicate_selector<predicate_function> select(predicate);
+
+		try
 		{
-			memory_use += sizeof(group) + (PLF_GROUP_ALIGNED_BLOCK_SIZE(current->capacity) * sizeof(aligned_allocation_struct)); // add memory block sizes and the size of the group structs themselves. The original calculation, including divisor, is necessary in order to correctly round up the number of allocations
+			for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			{
+				erase_selected_in_group(current_group, select);
+			}
+		}
+		catch (...)
+		{
+			relink_groups_after_erasure();
+			throw;
 		}
 
-		end_iterator.group_pointer->next_group = NULL; // unlink main groups and unused groups
-		return memory_use;
+		relink_groups_after_erasure();
+		return original_size - total_size;
 	}
 
 
 
 private:
 
-	// get all elements contiguous in memory and shrink to fit, remove erasures and erasure free lists. Invalidates all iterators and pointers to elements.
-	void consolidate()
+	void prepare_groups_for_assign(const size_type size)
 	{
-		#if defined(PLF_MOVE_SEMANTICS_SUPPORT) && defined(PLF_TYPE_TRAITS_SUPPORT)
-			if PLF_CONSTEXPR (std::is_move_constructible<element_type>::value && std::is_move_assignable<element_type>::value)
-			{
-				colony temp(plf::colony_limits(tuple_allocator_pair.min_group_capacity, group_allocator_pair.max_group_capacity));
-				temp.range_assign(std::make_move_iterator(begin_iterator), total_size);
-				*this = std::move(temp); // Avoid generating 2nd temporary
-			}
-			else
+		// Destroy all elements if non-trivial:
+		#ifdef PLF_TYPE_TRAITS_SUPPORT
+			if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
 		#endif
 		{
-			colony temp(*this);
-			swap(temp);
+			for (iterator current = begin_iterator; current != end_iterator; ++current)
+			{
+				PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
+			}
 		}
-	}
-
-
 
+		if (size < total_capacity && (total_capacity - size) >= tuple_allocator_pair.min_group_capacity)
+		{
+			size_type difference = total_capacity - size;
+			end_iterator.group_pointer->next_group = unused_groups_head;
 
-public:
+			// Remove surplus groups which're under the difference limit:
+			group_pointer_type current_group = begin_iterator.group_pointer, previous_group = NULL;
 
+			do
+			{
+				const group_pointer_type next_group = current_group->next_group;
 
-	void reshape(const plf::colony_limits capacities)
-	{
-		check_capacities_conformance(capacities);
-		tuple_allocator_pair.min_group_capacity = static_cast<skipfield_type>(capacities.min);
-		group_allocator_pair.max_group_capacity = static_cast<skipfield_type>(capacities.max);
+				if (current_group->capacity <= difference)
+				{ // Remove group:
+					difference -= current_group->capacity;
+					total_capacity -= current_group->capacity;
+					deallocate_group(current_group);
 
-		// Need to check all group sizes here, because splice might append smaller blocks to the end of a larger block:
-		for (group_pointer_type current = begin_iterator.group_pointer; current != end_iterator.group_pointer; current = current->next_group)
-		{
-			if (current->capacity < tuple_allocator_pair.min_group_capacity || current->capacity > group_allocator_pair.max_group_capacity)
-			{
-				#ifdef PLF_TYPE_TRAITS_SUPPORT // If type is non-copyable/movable, cannot be consolidated, throw exception:
-					if PLF_CONSTEXPR (!(std::is_copy_constructible<element_type>::value || std::is_move_constructible<element_type>::value))
+					if (current_group == begin_iterator.group_pointer)
 					{
-						throw;
+						begin_iterator.group_pointer = next_group;
 					}
-					else
-				#endif
+				}
+				else
 				{
-					consolidate();
+					if (previous_group != NULL)
+					{
+						previous_group->next_group = current_group;
+					}
+
+					previous_group = current_group;
 				}
 
-				return;
+				current_group = next_group;
+			} while (current_group != NULL);
+
+			previous_group->next_group = NULL;
+		}
+		else
+		{
+			if (size > total_capacity)
+			{
+				reserve(size);
 			}
+
+			// Join all unused_groups to main chain:
+			end_iterator.group_pointer->next_group = unused_groups_head;
 		}
+
+		begin_iterator.element_pointer = begin_iterator.group_pointer->elements;
+		begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield;
+		groups_with_erasures_list_head = NULL;
+		total_size = 0;
 	}
 
 
+public:
 
-	inline plf::colony_limits block_limits() const PLF_NOEXCEPT
+
+	// Fill assign:
+
+	inline void assign(const size_type size, const element_type &element)
 	{
-		return plf::colony_limits(static_cast<size_t>(tuple_allocator_pair.min_group_capacity), static_cast<size_t>(group_allocator_pair.max_group_capacity));
+		if (size == 0)
+		{
+			reset();
+			return;
+		}
+
+		prepare_groups_for_assign(size);
+		fill_unused_groups(size, element, 0, NULL, begin_iterator.group_pointer);
 	}
 
 
 
-	void clear() PLF_NOEXCEPT
+private:
+
+	// Range assign core:
+
+	template <class iterator_type>
+	inline void range_assign(const iterator_type it, const size_type size)
 	{
-		if (total_size == 0)
+		if (size == 0)
 		{
+			reset();
 			return;
 		}
 
-		// Destroy all elements if element type is non-trivial:
-		#ifdef PLF_TYPE_TRAITS_SUPPORT
-			if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
-		#endif
-		{
-			for (iterator current = begin_iterator; current != end_iterator; ++current)
-			{
-				PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
-			}
-		}
+		prepare_groups_for_assign(size);
+		range_fill_unused_groups(size, it, 0, NULL, begin_iterator.group_pointer);
+	}
 
-		if (begin_iterator.group_pointer != end_iterator.group_pointer)
-		{ // Move all other groups onto the unused_groups list
-			end_iterator.group_pointer->next_group = unused_groups_head;
-			unused_groups_head = begin_iterator.group_pointer->next_group;
-			end_iterator.group_pointer = begin_iterator.group_pointer; // other parts of iterator reset in the function below
-		}
 
-		reset_only_group_left(begin_iterator.group_pointer);
-		groups_with_erasures_list_head = NULL;
-		total_size = 0;
-	}
 
 
+public:
 
-	inline colony & operator = (const colony &source)
+	// Range assign:
+
+	template <class iterator_type>
+	inline void assign(const typename plf_enable_if_c<!std::numeric_limits<iterator_type>::is_integer, iterator_type>::type first, const iterator_type last)
 	{
-		assert(&source != this);
-		range_assign(source.begin_iterator, source.total_size);
-		return *this;
+		using std::distance;
+		range_assign(first, static_cast<size_type>(distance(first,last)));
 	}
 
 
 
-	#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-		// Move assignment
-		colony & operator = (colony &&source) PLF_NOEXCEPT_MOVE_ASSIGN(allocator_type)
+	// Range assign for use with sentinels:
+
+	#ifdef PLF_CPP20_SUPPORT
+		template <class iterator_type, class sentinel>
+			requires (!(std::convertible_to<sentinel, iterator_type> || std::convertible_to<iterator_type, sentinel> || std::integral<iterator_type> || std::integral<sentinel>) && std::sentinel_for<sentinel, iterator_type>)
+		inline void assign (const iterator_type first, const sentinel last)
 		{
-			assert(&source != this);
-			destroy_all_data();
+			size_type distance = 0;
+			for(iterator_type current = first; current != last; ++current, ++distance) {};
+			range_assign(first, distance);
+		}
+	#endif
 
-			#ifdef PLF_TYPE_TRAITS_SUPPORT
-				if PLF_CONSTEXPR (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value)
-				{
-					std::memcpy(static_cast<void *>(this), &source, sizeof(colony));
-				}
-				else
-			#endif
-			{
-				end_iterator = std::move(source.end_iterator);
-				begin_iterator = std::move(source.begin_iterator);
-				groups_with_erasures_list_head = std::move(source.groups_with_erasures_list_head);
-				unused_groups_head =  std::move(source.unused_groups_head);
-				total_size = source.total_size;
-				total_capacity = source.total_capacity;
-				tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity;
-				group_allocator_pair.max_group_capacity = source.group_allocator_pair.max_group_capacity;
-			}
 
-			source.blank();
-			return *this;
+
+	// Range assign, move_iterator overload:
+
+	#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+		template <class iterator_type>
+		inline void assign (const std::move_iterator<iterator_type> first, const std::move_iterator<iterator_type> last)
+		{
+			using std::distance;
+			range_assign(first, static_cast<size_type>(distance(first.base(),last.base())));
 		}
 	#endif
 
 
 
+	// Initializer-list assign:
+
 	#ifdef PLF_INITIALIZER_LIST_SUPPORT
-		inline colony & operator = (const std::initializer_list<element_type> &element_list)
+		inline void assign(const std::initializer_list<element_type> &element_list)
 		{
 			range_assign(element_list.begin(), static_cast<size_type>(element_list.size()));
-			return *this;
 		}
 	#endif
 
 
 
-	friend bool operator == (const colony &lh, const colony &rh)
-	{
-		if (lh.total_size != rh.total_size)
-		{
-			return false;
-		}
 
-		for (const_iterator lh_iterator = lh.begin_iterator, rh_iterator = rh.begin_iterator; lh_iterator != lh.end_iterator; ++lh_iterator, ++rh_iterator)
-		{
-			if (*lh_iterator != *rh_iterator)
-			{
-				return false;
-			}
-		}
+	#ifdef PLF_CPP20_SUPPORT
+		[[nodiscard]]
+	#endif
+	inline PLF_FORCE_INLINE bool empty() const PLF_NOEXCEPT
+	{
+		return total_size == 0;
+	}
 
-		return true;
+
+
+	inline size_type size() const PLF_NOEXCEPT
+	{
+		return total_size;
 	}
 
 
 
-	friend bool operator != (const colony &lh, const colony &rh)
+	inline static PLF_CONSTEXPR size_type block_metadata_memory(const size_type block_capacity)
 	{
-		return !(lh == rh);
+		return sizeof(group) + ((block_capacity + 1) * sizeof(skipfield_type));
 	}
 
 
 
-	#ifdef PLF_CPP20_SUPPORT
-		friend auto operator <=> (const colony &lh, const colony &rh)
+	#ifdef PLF_COLONY_TEST_DEBUG // used for debugging during internal testing only:
+		size_type group_size_sum() const PLF_NOEXCEPT
 		{
-			return std::lexicographical_compare_three_way(lh.begin(), lh.end(), rh.begin(), rh.end());
+			size_type temp = 0;
+
+			for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+			{
+				temp += current->size;
+			}
+
+			return temp;
 		}
 	#endif
 
 
 
-	void shrink_to_fit()
+	inline size_type max_size() const PLF_NOEXCEPT
 	{
-		if (total_size == total_capacity)
-		{
-			return;
-		}
-		else if (total_size == 0)
-		{
-			reset();
-			return;
-		}
-
-		consolidate();
+		#ifdef PLF_ALLOCATOR_TRAITS_SUPPORT
+			return std::allocator_traits<allocator_type>::max_size(*this);
+		#else
+			return allocator_type::max_size();
+		#endif
 	}
 
 
 
-	void trim() PLF_NOEXCEPT
+	inline size_type capacity() const PLF_NOEXCEPT
 	{
-		while(unused_groups_head != NULL)
-		{
-			total_capacity -= unused_groups_head->capacity;
-			const group_pointer_type next_group = unused_groups_head->next_group;
-			deallocate_group(unused_groups_head);
-			unused_groups_head = next_group;
-		}
+		return total_capacity;
 	}
 
 
 
-	void reserve(size_type new_capacity)
+	inline size_type memory() const PLF_NOEXCEPT
 	{
-		if (new_capacity == 0 || new_capacity <= total_capacity) // We already have enough space allocated
-		{
-			return;
-		}
+		size_type memory_use = sizeof(*this); // sizeof colony basic structure
+		end_iterator.group_pointer->next_group = unused_groups_head; // temporarily link the main groups and unused groups (reserved groups) in order to only have one loop below instead of several
 
-		if (new_capacity > max_size())
+		for(group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
 		{
-			throw std::length_error("Capacity requested via reserve() greater than maximum size returned by block_limits()");
+			memory_use += sizeof(group) + (PLF_GROUP_ALIGNED_BLOCK_SIZE(current->capacity) * sizeof(aligned_allocation_struct)); // add memory block sizes and the size of the group structs themselves. The original calculation, including divisor, is necessary in order to correctly round up the number of allocations
 		}
 
-		new_capacity -= total_capacity;
+		end_iterator.group_pointer->next_group = NULL; // unlink main groups and unused groups
+		return memory_use;
+	}
 
-		size_type number_of_max_groups = new_capacity / group_allocator_pair.max_group_capacity;
-		skipfield_type remainder = static_cast<skipfield_type>(new_capacity - (number_of_max_groups * group_allocator_pair.max_group_capacity));
 
 
-		if (remainder == 0)
-		{
-			remainder = group_allocator_pair.max_group_capacity;
-			--number_of_max_groups;
-		}
-		else if (remainder < tuple_allocator_pair.min_group_capacity)
+	// Group-level statistics for tuning block capacity limits and deciding when to compact. Gathered in time proportional to the number of groups and skipblocks - elements are not visited:
+	plf::colony_statistics statistics() const PLF_NOEXCEPT
+	{
+		plf::colony_statistics stats;
+		std::memset(static_cast<void *>(&stats), 0, sizeof(plf::colony_statistics));
+
+		if (total_size != 0)
 		{
-			remainder = tuple_allocator_pair.min_group_capacity;
-		}
+			for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+			{
+				++stats.number_of_groups;
+				++stats.fill_histogram[(current->size == current->capacity) ? plf::colony_statistics::fill_buckets - 1 : (static_cast<size_t>(current->size) * plf::colony_statistics::fill_buckets) / current->capacity];
 
+				size_t capacity_bucket = 0;
 
-		group_pointer_type current_group, first_unused_group;
+				for (size_t capacity = current->capacity; capacity > 1; capacity >>= 1)
+				{
+					++capacity_bucket;
+				}
 
-		if (begin_iterator.group_pointer == NULL) // Most common scenario - empty colony
-		{
-			initialize(remainder);
-			begin_iterator.group_pointer->last_endpoint = begin_iterator.group_pointer->elements; // last_endpoint initially == elements + 1 via default constructor
-			begin_iterator.group_pointer->size = 0; // 1 by default
+				++stats.capacity_histogram[capacity_bucket];
 
-			if (number_of_max_groups == 0)
-			{
-				return;
+				for (skipfield_type index = current->free_list_head; index != std::numeric_limits<skipfield_type>::max(); index = *(reinterpret_cast<skipfield_pointer_type>(current->elements + index))) // each free list node is the start of a skipblock, and stores the index of the previous node
+				{
+					++stats.total_skipblocks;
+				}
 			}
-			else
+
+			for (group_pointer_type current = groups_with_erasures_list_head; current != NULL; current = current->erasures_list_next_group)
 			{
-				first_unused_group = current_group = allocate_new_group(group_allocator_pair.max_group_capacity, begin_iterator.group_pointer);
-				total_capacity += group_allocator_pair.max_group_capacity;
-				--number_of_max_groups;
+				++stats.number_of_groups_with_erasures;
 			}
 		}
-		else // Non-empty colony, add first group:
+		else if (begin_iterator.group_pointer != NULL) // ie. a group retained by clear()
 		{
-			first_unused_group = current_group = allocate_new_group(remainder, end_iterator.group_pointer);
-			total_capacity += remainder;
+			++stats.number_of_unused_groups;
 		}
 
-
-		while (number_of_max_groups != 0)
+		for (group_pointer_type current = unused_groups_head; current != NULL; current = current->next_group)
 		{
-			try
-			{
-				current_group->next_group = allocate_new_group(group_allocator_pair.max_group_capacity, current_group);
-			}
-			catch (...)
-			{
-				deallocate_group(current_group->next_group);
-				current_group->next_group = unused_groups_head;
-				unused_groups_head = first_unused_group;
-				throw;
-			}
-
-			current_group = current_group->next_group;
-			total_capacity += group_allocator_pair.max_group_capacity;
-			--number_of_max_groups;
+			++stats.number_of_unused_groups;
 		}
 
-		current_group->next_group = unused_groups_head;
-		unused_groups_head = first_unused_group;
+		#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+			stats.group_allocations = allocation_counters.group_allocations;
+			stats.group_deallocations = allocation_counters.group_deallocations;
+			stats.group_recycles = allocation_counters.group_recycles;
+		#endif
+
+		return stats;
 	}
 
 
 
 private:
 
-	template <bool is_const>
-	colony_iterator<is_const> get_it(const pointer element_pointer) const PLF_NOEXCEPT
+	struct no_relocation_observer
 	{
-		typedef colony_iterator<is_const> iterator_type;
+		inline void operator() (const pointer, const pointer) const PLF_NOEXCEPT {}
+	};
 
-		if (total_size != 0) // Necessary here to prevent a pointer matching to an empty colony with one memory block retained with the skipfield wiped (see erase())
+
+
+	// Reports the new location of every element to a relocation observer, given the colony the elements were moved or copied from. Both colonies have the same element order:
+	template <class relocation_function>
+	void notify_relocations(const colony &original, relocation_function &relocated) const
+	{
+		for (const_iterator old_location = original.begin_iterator, new_location = begin_iterator; new_location != end_iterator; ++old_location, ++new_location)
 		{
-			 // Start with last group first, as will be the largest group in most cases:
-			for (group_pointer_type current_group = end_iterator.group_pointer; current_group != NULL; current_group = current_group->previous_group)
-			{
-				if (reinterpret_cast<aligned_pointer_type>(element_pointer) >= current_group->elements && reinterpret_cast<aligned_pointer_type>(element_pointer) < reinterpret_cast<aligned_pointer_type>(current_group->skipfield))
-				{
-					const skipfield_pointer_type skipfield_pointer = current_group->skipfield + (reinterpret_cast<aligned_pointer_type>(element_pointer) - current_group->elements);
-					return (*skipfield_pointer == 0) ? iterator_type(current_group, reinterpret_cast<aligned_pointer_type>(element_pointer), skipfield_pointer) : static_cast<iterator_type>(end_iterator); // If element has been erased, return end()
-				}
-			}
+			relocated(reinterpret_cast<pointer>(old_location.element_pointer), reinterpret_cast<pointer>(new_location.element_pointer));
 		}
-
-		return end_iterator;
 	}
 
 
 
-public:
+	inline void notify_relocations(const colony &, no_relocation_observer &) const PLF_NOEXCEPT {}
 
-	inline iterator get_iterator(const pointer element_pointer) PLF_NOEXCEPT
+
+
+	static inline cold_storage_type * cold_location(const const_iterator &it) PLF_NOEXCEPT
 	{
-		return get_it<false>(element_pointer);
+		#ifdef PLF_TYPE_TRAITS_SUPPORT
+			PLF_STATIC_ASSERT(std::is_trivially_copyable<cold_storage_type>::value, "cold_type must be trivially copyable");
+		#endif
+
+		return it.group_pointer->cold_values() + (it.skipfield_pointer - it.group_pointer->skipfield);
 	}
 
 
 
-	inline const_iterator get_iterator(const const_pointer element_pointer) const PLF_NOEXCEPT
+	// Copies cold values from a colony with the same element order, after its elements have been copied or moved to this one:
+	void copy_cold_values(const colony &source) PLF_NOEXCEPT
 	{
-		return get_it<true>(const_cast<pointer>(element_pointer));
+		if PLF_CONSTEXPR (cold_traits::size != 0)
+		{
+			for (const_iterator source_location = source.begin_iterator, location = begin_iterator; location != end_iterator; ++source_location, ++location)
+			{
+				*cold_location(location) = *cold_location(source_location);
+			}
+		}
 	}
 
 
 
-	inline allocator_type get_allocator() const PLF_NOEXCEPT
+	// get all elements contiguous in memory and shrink to fit, remove erasures and erasure free lists. Invalidates all iterators and pointers to elements. The original elements are kept until the observer has been notified, then destroyed and deallocated:
+	template <class relocation_function>
+	void consolidate(relocation_function relocated)
 	{
-		return *this;
+		#if defined(PLF_MOVE_SEMANTICS_SUPPORT) && defined(PLF_TYPE_TRAITS_SUPPORT)
+			if PLF_CONSTEXPR (std::is_move_constructible<element_type>::value && std::is_move_assignable<element_type>::value)
+			{
+				colony temp(plf::colony_limits(tuple_allocator_pair.min_group_capacity, group_allocator_pair.max_group_capacity), static_cast<const allocator_type &>(*this));
+				temp.range_assign(std::make_move_iterator(begin_iterator), total_size);
+				temp.set_growth_policy(growth_function.policy);
+				swap(temp);
+				copy_cold_values(temp);
+				notify_relocations(temp, relocated);
+				absorb_allocation_counters(temp);
+			}
+			else
+		#endif
+		{
+			colony temp(*this); // copies cold values
+			temp.set_growth_policy(growth_function.policy);
+			swap(temp);
+			notify_relocations(temp, relocated);
+			absorb_allocation_counters(temp);
+		}
 	}
 
 
 
-	void splice(colony &source)
-	{
-		// Process: if there are unused memory spaces at the end of the current back group of the chain, convert them
-		// to skipped elements and add the locations to the group's free list.
-		// Then link the destination's groups to the source's groups and nullify the source.
-		// If the source has more unused memory spaces in the back group than the destination, swap them before processing to reduce the number of locations added to a free list and also subsequent jumps during iteration.
-
-		assert(&source != this);
 
-		if (source.total_size == 0)
+	// Used by consolidate_step - returns the group with the fewest elements out of those whose elements would all fit into the unused element slots of the other active groups, or NULL if there is no such group:
+	group_pointer_type find_group_to_evacuate() const PLF_NOEXCEPT
+	{
+		if (begin_iterator.group_pointer == end_iterator.group_pointer)
 		{
-			return;
+			return NULL;
 		}
-		else if (total_size == 0)
-		{
-			#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-				*this = std::move(source);
-			#else
-				reset();
-				swap(source);
-			#endif
 
-			return;
-		}
+		size_type free_slots = 0;
 
-		// If there's more unused element locations in back memory block of destination than in back memory block of source, swap with source to reduce number of skipped elements during iteration, and reduce size of free-list:
-		if ((reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) > (reinterpret_cast<aligned_pointer_type>(source.end_iterator.group_pointer->skipfield) - source.end_iterator.element_pointer))
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
 		{
-			swap(source);
+			free_slots += static_cast<size_type>(current->capacity - current->size);
 		}
 
+		group_pointer_type sparsest_group = NULL;
 
-		// Throw if incompatible group capacity found:
-		if (source.tuple_allocator_pair.min_group_capacity < tuple_allocator_pair.min_group_capacity || source.group_allocator_pair.max_group_capacity > group_allocator_pair.max_group_capacity)
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
 		{
-			for (group_pointer_type current_group = source.begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			// ie. free slots outside of this group >= this group's size:
+			if (static_cast<size_type>(current->capacity) <= free_slots && (sparsest_group == NULL || current->size < sparsest_group->size))
 			{
-				if (current_group->capacity < tuple_allocator_pair.min_group_capacity || current_group->capacity > group_allocator_pair.max_group_capacity)
-				{
-					throw std::length_error("A source memory block capacity is outside of the destination's minimum or maximum memory block capacity limits - please change either the source or the destination's min/max block capacity limits using reshape() before calling splice() in this case");
-				}
+				sparsest_group = current;
 			}
 		}
 
+		return sparsest_group;
+	}
 
-		// Add source list of groups-with-erasures to destination list of groups-with-erasures:
-		if (source.groups_with_erasures_list_head != NULL)
-		{
-			if (groups_with_erasures_list_head != NULL)
-			{
-				group_pointer_type tail_group = groups_with_erasures_list_head;
-
-				while (tail_group->erasures_list_next_group != NULL)
-				{
-					tail_group = tail_group->erasures_list_next_group;
-				}
-
-				tail_group->erasures_list_next_group = source.groups_with_erasures_list_head;
-			}
-			else
-			{
-				groups_with_erasures_list_head = source.groups_with_erasures_list_head;
-			}
-		}
 
 
-		const skipfield_type distance_to_end = static_cast<skipfield_type>(reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer);
+public:
 
-		if (distance_to_end != 0) // 0 == edge case
-		{	 // Mark unused element memory locations from back group as skipped/erased:
+	// Incremental alternative to shrink_to_fit(): moves up to max_elements elements out of the sparsest groups and into erased/unused slots in other groups, so that emptied groups are released (or, for the back group, retained as reserved capacity) one at a time. For each element moved, relocated(old_location, new_location) is called once the colony is in a valid state again - old_location no longer contains an element at that point and must only be used as a key. Only iterators and pointers to moved elements are invalidated. Returns the number of elements moved - a return value less than max_elements means no further group can be emptied:
+	template <class relocation_function>
+	size_type consolidate_step(const size_type max_elements, relocation_function relocated)
+	{
+		size_type number_moved = 0;
 
-			// Update skipfield:
-			const skipfield_type previous_node_value = *(end_iterator.skipfield_pointer - 1);
-			end_iterator.group_pointer->last_endpoint = reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield);
+		for (group_pointer_type source_group; number_moved != max_elements && (source_group = find_group_to_evacuate()) != NULL;)
+		{
+			skipfield_type remaining = source_group->size;
 
-			if (previous_node_value == 0) // no previous skipblock
+			// Detach the source group from the groups-with-erasures list so that insertions cannot reuse its slots. Erasing from it below puts it back at the head of the list, from where it is detached again in O(1) before each subsequent insertion:
+			if (source_group->free_list_head != std::numeric_limits<skipfield_type>::max())
 			{
-				*end_iterator.skipfield_pointer = distance_to_end;
-				*(end_iterator.skipfield_pointer + distance_to_end - 1) = distance_to_end;
+				remove_from_groups_with_erasures_list(source_group);
+			}
 
-				const skipfield_type index = static_cast<skipfield_type>(end_iterator.element_pointer - end_iterator.group_pointer->elements);
+			while (true)
+			{
+				const iterator source(source_group, source_group->elements + *(source_group->skipfield), source_group->skipfield + *(source_group->skipfield));
+				iterator destination;
 
-				if (end_iterator.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+				try
 				{
-					*(reinterpret_cast<skipfield_pointer_type>(end_iterator.group_pointer->elements + end_iterator.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
+					#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+						destination = insert(std::move(*source));
+					#else
+						destination = insert(*source);
+					#endif
 				}
-				else
+				catch (...)
+				{
+					if (source_group->free_list_head != std::numeric_limits<skipfield_type>::max())
+					{
+						source_group->erasures_list_next_group = groups_with_erasures_list_head;
+						groups_with_erasures_list_head = source_group;
+					}
+
+					throw;
+				}
+
+				if (source_group->free_list_head != std::numeric_limits<skipfield_type>::max())
+				{
+					source_group->erasures_list_next_group = groups_with_erasures_list_head;
+					groups_with_erasures_list_head = source_group;
+				}
+
+				if PLF_CONSTEXPR (cold_traits::size != 0)
+				{
+					*cold_location(destination) = *cold_location(source);
+				}
+
+				erase(source);
+				relocated(reinterpret_cast<pointer>(source.element_pointer), reinterpret_cast<pointer>(destination.element_pointer));
+
+				if (++number_moved == max_elements || --remaining == 0) // If the group is now empty, erase() has removed it
+				{
+					break;
+				}
+
+				groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
+			}
+		}
+
+		return number_moved;
+	}
+
+
+
+	inline size_type consolidate_step(const size_type max_elements)
+	{
+		return consolidate_step(max_elements, no_relocation_observer());
+	}
+
+
+
+	// As per reshape(capacities), but if elements have to be relocated, calls relocated(old_location, new_location) for each element once the colony is in its new state. old_location must only be used as a key, as it is deallocated after the last call:
+	template <class relocation_function>
+	void reshape(const plf::colony_limits capacities, relocation_function relocated)
+	{
+		check_capacities_conformance(capacities);
+		tuple_allocator_pair.min_group_capacity = static_cast<skipfield_type>(capacities.min);
+		group_allocator_pair.max_group_capacity = static_cast<skipfield_type>(capacities.max);
+
+		// Need to check all group sizes here, because splice might append smaller blocks to the end of a larger block:
+		for (group_pointer_type current = begin_iterator.group_pointer; current != end_iterator.group_pointer; current = current->next_group)
+		{
+			if (current->capacity < tuple_allocator_pair.min_group_capacity || current->capacity > group_allocator_pair.max_group_capacity)
+			{
+				#ifdef PLF_TYPE_TRAITS_SUPPORT // If type is non-copyable/movable, cannot be consolidated, throw exception:
+					if PLF_CONSTEXPR (!(std::is_copy_constructible<element_type>::value || std::is_move_constructible<element_type>::value))
+					{
+						throw;
+					}
+					else
+				#endif
+				{
+					consolidate(relocated);
+				}
+
+				return;
+			}
+		}
+	}
+
+
+
+	inline void reshape(const plf::colony_limits capacities)
+	{
+		reshape(capacities, no_relocation_observer());
+	}
+
+
+
+	inline plf::colony_limits block_limits() const PLF_NOEXCEPT
+	{
+		return plf::colony_limits(static_cast<size_t>(tuple_allocator_pair.min_group_capacity), static_cast<size_t>(group_allocator_pair.max_group_capacity));
+	}
+
+
+
+	// Sets the function choosing the capacity of each new group allocated by insert/emplace, in place of the default of doubling total capacity. NULL restores the default. The policy is kept by copies, and moved or swapped along with the colony's contents. Does not affect groups allocated by reserve() or range/fill insertion, which are sized to the request:
+	void set_growth_policy(const plf::colony_growth_policy policy) PLF_NOEXCEPT
+	{
+		growth_function.policy = policy;
+		growth_reuses.count = (end_iterator.group_pointer != NULL) ? end_iterator.group_pointer->capacity : 0; // The back group was not filled since the policy was last called, so is not evidence of a burst
+	}
+
+
+
+	inline plf::colony_growth_policy growth_policy() const PLF_NOEXCEPT
+	{
+		return growth_function.policy;
+	}
+
+
+
+	// Returns the largest group capacity whose memory block fits within block_bytes, or 0 if a group of the minimum capacity (2) does not fit. eg. using the result as both the minimum and maximum block capacity, with a colony_huge_page_arena's block_bytes(), makes each group's memory block fill one huge page:
+	static size_type block_capacity_for_bytes(const size_t block_bytes) PLF_NOEXCEPT
+	{
+		size_type lower = 1, upper = static_cast<size_type>(std::numeric_limits<skipfield_type>::max()) + 1;
+
+		while (upper - lower > 1) // lower is 1 or fits, upper does not fit or is out of range
+		{
+			const size_type middle = lower + ((upper - lower) >> 1);
+
+			if (static_cast<size_t>(PLF_GROUP_ALIGNED_BLOCK_SIZE(middle)) * sizeof(aligned_allocation_struct) <= block_bytes)
+			{
+				lower = middle;
+			}
+			else
+			{
+				upper = middle;
+			}
+		}
+
+		return (lower < 2) ? 0 : lower;
+	}
+
+
+
+	void clear() PLF_NOEXCEPT
+	{
+		if (total_size == 0)
+		{
+			return;
+		}
+
+		if PLF_CONSTEXPR (generational)
+		{
+			increment_generations(begin_iterator, end_iterator);
+		}
+
+		// Destroy all elements if element type is non-trivial:
+		#ifdef PLF_TYPE_TRAITS_SUPPORT
+			if PLF_CONSTEXPR (!std::is_trivially_destructible<element_type>::value)
+		#endif
+		{
+			for (iterator current = begin_iterator; current != end_iterator; ++current)
+			{
+				PLF_DESTROY(allocator_type, *this, reinterpret_cast<pointer>(current.element_pointer));
+			}
+		}
+
+		if (begin_iterator.group_pointer != end_iterator.group_pointer)
+		{ // Move all other groups onto the unused_groups list
+			end_iterator.group_pointer->next_group = unused_groups_head;
+			unused_groups_head = begin_iterator.group_pointer->next_group;
+			end_iterator.group_pointer = begin_iterator.group_pointer; // other parts of iterator reset in the function below
+		}
+
+		reset_only_group_left(begin_iterator.group_pointer);
+		groups_with_erasures_list_head = NULL;
+		total_size = 0;
+	}
+
+
+
+	inline colony & operator = (const colony &source)
+	{
+		assert(&source != this);
+		range_assign(source.begin_iterator, source.total_size);
+		copy_cold_values(source);
+		return *this;
+	}
+
+
+
+	#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+		// Move assignment
+		colony & operator = (colony &&source) PLF_NOEXCEPT_MOVE_ASSIGN(allocator_type)
+		{
+			assert(&source != this);
+			destroy_all_data();
+
+			#ifdef PLF_TYPE_TRAITS_SUPPORT
+				if PLF_CONSTEXPR (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value)
+				{
+					#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+						const allocation_counter_set counters = allocation_counters;
+						std::memcpy(static_cast<void *>(this), &source, sizeof(colony));
+						allocation_counters = counters;
+					#else
+						std::memcpy(static_cast<void *>(this), &source, sizeof(colony));
+					#endif
+				}
+				else
+			#endif
+			{
+				end_iterator = std::move(source.end_iterator);
+				begin_iterator = std::move(source.begin_iterator);
+				groups_with_erasures_list_head = std::move(source.groups_with_erasures_list_head);
+				unused_groups_head =  std::move(source.unused_groups_head);
+				total_size = source.total_size;
+				total_capacity = source.total_capacity;
+				tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity;
+				group_allocator_pair.max_group_capacity = source.group_allocator_pair.max_group_capacity;
+				growth_reuses = source.growth_reuses;
+				growth_function = source.growth_function;
+			}
+
+			source.blank();
+			return *this;
+		}
+	#endif
+
+
+
+	#ifdef PLF_INITIALIZER_LIST_SUPPORT
+		inline colony & operator = (const std::initializer_list<element_type> &element_list)
+		{
+			range_assign(element_list.begin(), static_cast<size_type>(element_list.size()));
+			return *this;
+		}
+	#endif
+
+
+
+	friend bool operator == (const colony &lh, const colony &rh)
+	{
+		if (lh.total_size != rh.total_size)
+		{
+			return false;
+		}
+
+		for (const_iterator lh_iterator = lh.begin_iterator, rh_iterator = rh.begin_iterator; lh_iterator != lh.end_iterator; ++lh_iterator, ++rh_iterator)
+		{
+			if (*lh_iterator != *rh_iterator)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+
+	friend bool operator != (const colony &lh, const colony &rh)
+	{
+		return !(lh == rh);
+	}
+
+
+
+	#ifdef PLF_CPP20_SUPPORT
+		friend auto operator <=> (const colony &lh, const colony &rh)
+		{
+			return std::lexicographical_compare_three_way(lh.begin(), lh.end(), rh.begin(), rh.end());
+		}
+	#endif
+
+
+
+	// As per shrink_to_fit(), but calls relocated(old_location, new_location) for each element once the colony is in its new state, allowing external pointers to be updated. old_location must only be used as a key, as it is deallocated after the last call:
+	template <class relocation_function>
+	void shrink_to_fit(relocation_function relocated)
+	{
+		if (total_size == total_capacity)
+		{
+			return;
+		}
+		else if (total_size == 0)
+		{
+			reset();
+			return;
+		}
+
+		consolidate(relocated);
+	}
+
+
+
+	inline void shrink_to_fit()
+	{
+		shrink_to_fit(no_relocation_observer());
+	}
+
+
+
+	void trim() PLF_NOEXCEPT
+	{
+		while(unused_groups_head != NULL)
+		{
+			total_capacity -= unused_groups_head->capacity;
+			const group_pointer_type next_group = unused_groups_head->next_group;
+			deallocate_group(unused_groups_head);
+			unused_groups_head = next_group;
+		}
+	}
+
+
+
+	void reserve(size_type new_capacity)
+	{
+		if (new_capacity == 0 || new_capacity <= total_capacity) // We already have enough space allocated
+		{
+			return;
+		}
+
+		if (new_capacity > max_size())
+		{
+			throw std::length_error("Capacity requested via reserve() greater than maximum size returned by block_limits()");
+		}
+
+		new_capacity -= total_capacity;
+
+		size_type number_of_max_groups = new_capacity / group_allocator_pair.max_group_capacity;
+		skipfield_type remainder = static_cast<skipfield_type>(new_capacity - (number_of_max_groups * group_allocator_pair.max_group_capacity));
+
+
+		if (remainder == 0)
+		{
+			remainder = group_allocator_pair.max_group_capacity;
+			--number_of_max_groups;
+		}
+		else if (remainder < tuple_allocator_pair.min_group_capacity)
+		{
+			remainder = tuple_allocator_pair.min_group_capacity;
+		}
+
+
+		group_pointer_type current_group, first_unused_group;
+
+		if (begin_iterator.group_pointer == NULL) // Most common scenario - empty colony
+		{
+			initialize(remainder);
+			begin_iterator.group_pointer->last_endpoint = begin_iterator.group_pointer->elements; // last_endpoint initially == elements + 1 via default constructor
+			begin_iterator.group_pointer->size = 0; // 1 by default
+
+			if (number_of_max_groups == 0)
+			{
+				return;
+			}
+			else
+			{
+				first_unused_group = current_group = allocate_new_group(group_allocator_pair.max_group_capacity, begin_iterator.group_pointer);
+				total_capacity += group_allocator_pair.max_group_capacity;
+				--number_of_max_groups;
+			}
+		}
+		else // Non-empty colony, add first group:
+		{
+			first_unused_group = current_group = allocate_new_group(remainder, end_iterator.group_pointer);
+			total_capacity += remainder;
+		}
+
+
+		while (number_of_max_groups != 0)
+		{
+			try
+			{
+				current_group->next_group = allocate_new_group(group_allocator_pair.max_group_capacity, current_group);
+			}
+			catch (...)
+			{
+				deallocate_group(current_group->next_group);
+				current_group->next_group = unused_groups_head;
+				unused_groups_head = first_unused_group;
+				throw;
+			}
+
+			current_group = current_group->next_group;
+			total_capacity += group_allocator_pair.max_group_capacity;
+			--number_of_max_groups;
+		}
+
+		current_group->next_group = unused_groups_head;
+		unused_groups_head = first_unused_group;
+	}
+
+
+
+private:
+
+	template <bool is_const>
+	colony_iterator<is_const> get_it(const pointer element_pointer) const PLF_NOEXCEPT
+	{
+		typedef colony_iterator<is_const> iterator_type;
+
+		if (total_size != 0) // Necessary here to prevent a pointer matching to an empty colony with one memory block retained with the skipfield wiped (see erase())
+		{
+			 // Start with last group first, as will be the largest group in most cases:
+			for (group_pointer_type current_group = end_iterator.group_pointer; current_group != NULL; current_group = current_group->previous_group)
+			{
+				if (reinterpret_cast<aligned_pointer_type>(element_pointer) >= current_group->elements && reinterpret_cast<aligned_pointer_type>(element_pointer) < reinterpret_cast<aligned_pointer_type>(current_group->skipfield))
+				{
+					const skipfield_pointer_type skipfield_pointer = current_group->skipfield + (reinterpret_cast<aligned_pointer_type>(element_pointer) - current_group->elements);
+					return (*skipfield_pointer == 0) ? iterator_type(current_group, reinterpret_cast<aligned_pointer_type>(element_pointer), skipfield_pointer) : static_cast<iterator_type>(end_iterator); // If element has been erased, return end()
+				}
+			}
+		}
+
+		return end_iterator;
+	}
+
+
+
+public:
+
+	inline iterator get_iterator(const pointer element_pointer) PLF_NOEXCEPT
+	{
+		return get_it<false>(element_pointer);
+	}
+
+
+
+	inline const_iterator get_iterator(const const_pointer element_pointer) const PLF_NOEXCEPT
+	{
+		return get_it<true>(const_cast<pointer>(element_pointer));
+	}
+
+
+
+	// Generational mode only. A handle identifies an element by group, index and the generation of that index at the time the handle was taken. Erasing the element increments the index's generation, so a handle can be checked for validity after its element has been erased and the location reused, unlike a pointer or iterator. Handles remain checkable through insert, erase, clear and splice (after splice they refer to the destination colony), as groups are never deallocated by erasure in generational mode. Handles are invalidated (may not be checked) by reset, assign, operator =, shrink_to_fit, trim_capacity, reshape and destruction. Since a handle refers to a location, values moved by sort or unique are not tracked. Generations wrap at the maximum generation_type value (at least 65535), at which point a very old handle may compare as valid again:
+	class handle
+	{
+	private:
+		group_pointer_type group_pointer;
+		skipfield_type index;
+		generation_type generation;
+
+		handle(const group_pointer_type group_p, const skipfield_type index_value, const generation_type generation_value) PLF_NOEXCEPT:
+			group_pointer(group_p),
+			index(index_value),
+			generation(generation_value)
+		{}
+
+		friend class colony;
+
+	public:
+		handle() PLF_NOEXCEPT:
+			group_pointer(NULL),
+			index(0),
+			generation(0)
+		{}
+
+		inline bool operator == (const handle &rh) const PLF_NOEXCEPT
+		{
+			return group_pointer == rh.group_pointer && index == rh.index && generation == rh.generation;
+		}
+
+		inline bool operator != (const handle &rh) const PLF_NOEXCEPT
+		{
+			return !(*this == rh);
+		}
+	};
+
+
+
+	inline handle get_handle(const const_iterator &it) const PLF_NOEXCEPT
+	{
+		PLF_STATIC_ASSERT(generational, "Handles are only available when the colony's generational template parameter is true");
+		assert(it.group_pointer != NULL && it.element_pointer != it.group_pointer->last_endpoint); // ie. not uninitialized iterator or end()
+
+		const skipfield_type index = static_cast<skipfield_type>(it.skipfield_pointer - it.group_pointer->skipfield);
+		return handle(it.group_pointer, index, it.group_pointer->generations()[index]);
+	}
+
+
+
+	inline bool is_valid(const handle &h) const PLF_NOEXCEPT
+	{
+		PLF_STATIC_ASSERT(generational, "Handles are only available when the colony's generational template parameter is true");
+		return h.group_pointer != NULL && h.group_pointer->generations()[h.index] == h.generation && h.group_pointer->elements + h.index < h.group_pointer->last_endpoint && h.group_pointer->skipfield[h.index] == 0;
+	}
+
+
+
+	// Returns NULL if the element the handle refers to has been erased:
+	inline pointer get(const handle &h) PLF_NOEXCEPT
+	{
+		return (is_valid(h)) ? reinterpret_cast<pointer>(h.group_pointer->elements + h.index) : NULL;
+	}
+
+
+
+	inline const_pointer get(const handle &h) const PLF_NOEXCEPT
+	{
+		return (is_valid(h)) ? reinterpret_cast<const_pointer>(h.group_pointer->elements + h.index) : NULL;
+	}
+
+
+
+	inline iterator get_iterator(const handle &h) PLF_NOEXCEPT
+	{
+		return (is_valid(h)) ? iterator(h.group_pointer, h.group_pointer->elements + h.index, h.group_pointer->skipfield + h.index) : end_iterator;
+	}
+
+
+
+	// Cold values - only when cold_type is not void. Each element has a cold_type value stored in a separate array in its group, at the same index and governed by the same skipfield as the element, so that rarely-accessed data can be kept out of the cache lines of frequently-iterated elements without losing pointer stability. Cold values follow their elements through copy, sort, shrink_to_fit, reshape and consolidate_step. cold_type must be trivially copyable. The cold value of an element inserted by any means other than insert_with_cold is unspecified (zero if its location has never been used):
+	inline cold_storage_type & cold(const const_iterator &it) PLF_NOEXCEPT
+	{
+		PLF_STATIC_ASSERT(cold_traits::size != 0, "Cold values are only available when the colony's cold_type template parameter is not void");
+		assert(it.group_pointer != NULL && it.element_pointer != it.group_pointer->last_endpoint); // ie. not uninitialized iterator or end()
+		return *cold_location(it);
+	}
+
+
+
+	inline const cold_storage_type & cold(const const_iterator &it) const PLF_NOEXCEPT
+	{
+		PLF_STATIC_ASSERT(cold_traits::size != 0, "Cold values are only available when the colony's cold_type template parameter is not void");
+		assert(it.group_pointer != NULL && it.element_pointer != it.group_pointer->last_endpoint);
+		return *cold_location(it);
+	}
+
+
+
+	inline iterator insert_with_cold(const element_type &element, const cold_storage_type &cold_value)
+	{
+		PLF_STATIC_ASSERT(cold_traits::size != 0, "Cold values are only available when the colony's cold_type template parameter is not void");
+		const iterator new_element = insert(element);
+		*cold_location(new_element) = cold_value;
+		return new_element;
+	}
+
+
+
+	#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+		inline iterator insert_with_cold(element_type &&element, const cold_storage_type &cold_value)
+		{
+			PLF_STATIC_ASSERT(cold_traits::size != 0, "Cold values are only available when the colony's cold_type template parameter is not void");
+			const iterator new_element = insert(std::move(element));
+			*cold_location(new_element) = cold_value;
+			return new_element;
+		}
+	#endif
+
+
+
+private:
+
+	template <bool is_const, class output_iterator_type>
+	output_iterator_type get_rng(const size_type number_of_ranges, output_iterator_type output) const
+	{
+		typedef colony_iterator<is_const> iterator_type;
+
+		if (total_size == 0 || number_of_ranges == 0)
+		{
+			return output;
+		}
+
+		// Ranges are split on group boundaries only, so that each range can be iterated independently of the others. A split occurs after any group which takes the running element count to or past the next of the (number_of_ranges - 1) evenly-spaced split points, total_size * N / number_of_ranges. Each split point is held as a quotient and remainder and advanced by addition, so that no product can overflow size_type. More ranges than elements would split at every group boundary regardless, so number_of_ranges is capped at total_size:
+		const size_type ranges = (number_of_ranges < total_size) ? number_of_ranges : total_size;
+		const size_type split_step = total_size / ranges, split_step_remainder = total_size % ranges;
+		size_type running_size = 0, split_point = split_step, split_point_remainder = split_step_remainder;
+		iterator_type range_begin = begin_iterator;
+
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != end_iterator.group_pointer; current_group = current_group->next_group)
+		{
+			running_size += current_group->size;
+
+			if (running_size > split_point || (running_size == split_point && split_point_remainder == 0))
+			{
+				const group_pointer_type next_group = current_group->next_group;
+				const iterator_type range_end(next_group, next_group->elements + *(next_group->skipfield), next_group->skipfield + *(next_group->skipfield));
+
+				*output = std::pair<iterator_type, iterator_type>(range_begin, range_end);
+				++output;
+				range_begin = range_end;
+
+				do // Skip any split points also passed by this group, in the case of a large group
+				{
+					split_point += split_step;
+					split_point_remainder += split_step_remainder;
+
+					if (split_point_remainder >= ranges)
+					{
+						split_point_remainder -= ranges;
+						++split_point;
+					}
+				} while (running_size > split_point || (running_size == split_point && split_point_remainder == 0));
+			}
+		}
+
+		// The back group always ends the final range (as no group is empty, running_size is always less than total_size before the back group, so this is never more than number_of_ranges ranges in total):
+		*output = std::pair<iterator_type, iterator_type>(range_begin, end_iterator);
+		++output;
+		return output;
+	}
+
+
+
+public:
+
+	// Writes up to number_of_ranges std::pair's of (first, last) iterators to output, which together cover the whole colony in order. Ranges contain approximately equal numbers of elements but are split on group boundaries, so fewer ranges than requested will be written if there are not enough groups. Returns the output iterator, one past the last range written:
+	template <class output_iterator_type>
+	inline output_iterator_type get_ranges(const size_type number_of_ranges, output_iterator_type output)
+	{
+		return get_rng<false>(number_of_ranges, output);
+	}
+
+
+
+	template <class output_iterator_type>
+	inline output_iterator_type get_ranges(const size_type number_of_ranges, output_iterator_type output) const
+	{
+		return get_rng<true>(number_of_ranges, output);
+	}
+
+
+
+private:
+
+	template <class block_pointer_type, class function_type>
+	void for_each_blk(function_type &function) const
+	{
+		if (total_size == 0)
+		{
+			return;
+		}
+
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+		{
+			const size_type end_index = static_cast<size_type>(current_group->last_endpoint - current_group->elements);
+
+			if (current_group->free_list_head == std::numeric_limits<skipfield_type>::max()) // No erasures in group, so the whole group is one run and the skipfield need not be read
+			{
+				function(reinterpret_cast<block_pointer_type>(current_group->elements), end_index);
+				continue;
+			}
+
+			const skipfield_pointer_type skipfield = current_group->skipfield;
+			size_type index = *skipfield; // If the first element is erased, the first skipfield node is the start node of a skipblock, and holds the length of that skipblock
+
+			while (index != end_index)
+			{
+				const size_type run_start = index;
+
+				index = static_cast<size_type>(find_skipblock(skipfield + index, skipfield + end_index) - skipfield);
+
+				function(reinterpret_cast<block_pointer_type>(current_group->elements + run_start), index - run_start);
+
+				if (index != end_index)
+				{
+					index += *(skipfield + index); // jump over skipblock - runs of non-erased elements are always bounded by either a skipblock start node or the end of the group
+				}
+			}
+		}
+	}
+
+
+
+public:
+
+	// Calls function(pointer, count) for each contiguous run of non-erased elements, in iteration order. A group with no erasures is passed as a single run. This allows per-element operations to be performed over plain arrays, without per-element skipfield reads:
+	template <class function_type>
+	inline void for_each_block(function_type function)
+	{
+		for_each_blk<pointer>(function);
+	}
+
+
+
+	template <class function_type>
+	inline void for_each_block(function_type function) const
+	{
+		for_each_blk<const_pointer>(function);
+	}
+
+
+
+private:
+
+	template <class element_pointer_type, class function_type>
+	void for_each_pf(function_type &function, const size_type prefetch_distance) const
+	{
+		if (total_size == 0)
+		{
+			return;
+		}
+
+		const size_type minimum_lookahead = (sizeof(aligned_element_type) >= 1024) ? 1 : 1024 / sizeof(aligned_element_type); // ~1KB of elements
+		const size_type group_lookahead = (prefetch_distance > minimum_lookahead) ? prefetch_distance : minimum_lookahead; // Elements from the end of a group at which the next group is prefetched
+
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+		{
+			const group_pointer_type next_group = current_group->next_group;
+			const aligned_pointer_type elements = current_group->elements;
+			const skipfield_pointer_type skipfield = current_group->skipfield;
+			const size_type end_index = static_cast<size_type>(current_group->last_endpoint - elements);
+			const bool no_erasures = current_group->free_list_head == std::numeric_limits<skipfield_type>::max();
+			size_type next_group_prefetch_index = (next_group == NULL) ? std::numeric_limits<size_type>::max() : ((end_index > group_lookahead) ? end_index - group_lookahead : 0);
+
+			if (next_group != NULL)
+			{
+				PLF_PREFETCH(&*next_group); // so that reading the next group's element and skipfield pointers below does not miss
+			}
+
+			for (size_type index = (no_erasures) ? 0 : static_cast<size_type>(*skipfield); index != end_index;)
+			{
+				if (prefetch_distance != 0 && index + prefetch_distance < end_index)
+				{
+					PLF_PREFETCH(&*(elements + index + prefetch_distance));
+				}
+
+				if (index >= next_group_prefetch_index) // Nearing the end of the group - the next group is a separate allocation, which the hardware prefetcher will not anticipate
+				{
+					PLF_PREFETCH(&*(next_group->elements));
+					PLF_PREFETCH(&*(next_group->skipfield));
+					next_group_prefetch_index = std::numeric_limits<size_type>::max();
+				}
+
+				function(*reinterpret_cast<element_pointer_type>(elements + index));
+				index += (no_erasures) ? 1u : 1u + static_cast<size_type>(skipfield[index + 1]);
+			}
+		}
+	}
+
+
+
+public:
+
+	// Calls function(element) for each element in iteration order, prefetching the start of the next group's elements and skipfield when nearing the end of the current group (within prefetch_distance elements, or roughly 1KB of elements if greater), since hardware prefetchers lose track at group boundaries. If prefetch_distance is non-zero the element that many locations ahead within the group (erased locations included) is also prefetched - this is off by default as hardware prefetchers generally handle contiguous elements well. Has no effect beyond a plain traversal on compilers without a prefetch intrinsic:
+	template <class function_type>
+	inline void for_each_prefetched(function_type function, const size_type prefetch_distance = 0)
+	{
+		for_each_pf<pointer>(function, prefetch_distance);
+	}
+
+
+
+	template <class function_type>
+	inline void for_each_prefetched(function_type function, const size_type prefetch_distance = 0) const
+	{
+		for_each_pf<const_pointer>(function, prefetch_distance);
+	}
+
+
+
+	#ifdef PLF_EXECUTION_POLICY_SUPPORT
+		// Applies function to every element, using std::for_each with the supplied execution policy over the ranges from get_ranges(). If number_of_ranges is 0, one range per group is used and load-balancing is left to the policy's implementation:
+		template <class execution_policy, class function_type>
+		void for_each_parallel(execution_policy &&policy, function_type function, size_type number_of_ranges = 0)
+		{
+			if (total_size == 0)
+			{
+				return;
+			}
+
+			if (number_of_ranges == 0)
+			{
+				number_of_ranges = (end_iterator.group_pointer->group_number - begin_iterator.group_pointer->group_number) + 1; // Group numbers may be non-contiguous after a range-erase, so this may overestimate, which is fine
+			}
+
+			typedef std::pair<iterator, iterator> range_type;
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<range_type> range_allocator_type;
+			typedef typename std::allocator_traits<range_allocator_type>::pointer range_pointer_type;
+
+			range_allocator_type range_allocator(*this);
+			const range_pointer_type ranges = std::allocator_traits<range_allocator_type>::allocate(range_allocator, number_of_ranges);
+
+			for (size_type index = 0; index != number_of_ranges; ++index)
+			{
+				std::allocator_traits<range_allocator_type>::construct(range_allocator, &*(ranges + index));
+			}
+
+			range_type * const ranges_begin = &*ranges;
+			range_type * const ranges_end = get_rng<false>(number_of_ranges, ranges_begin);
+
+			try
+			{
+				std::for_each(std::forward<execution_policy>(policy), ranges_begin, ranges_end, [&function](const range_type &range)
+				{
+					for (iterator current = range.first; current != range.second; ++current)
+					{
+						function(*current);
+					}
+				});
+			}
+			catch (...)
+			{
+				std::allocator_traits<range_allocator_type>::deallocate(range_allocator, ranges, number_of_ranges);
+				throw;
+			}
+
+			std::allocator_traits<range_allocator_type>::deallocate(range_allocator, ranges, number_of_ranges);
+		}
+	#endif
+
+
+
+	inline allocator_type get_allocator() const PLF_NOEXCEPT
+	{
+		return *this;
+	}
+
+
+
+	void splice(colony &source)
+	{
+		// Process: if there are unused memory spaces at the end of the current back group of the chain, convert them
+		// to skipped elements and add the locations to the group's free list.
+		// Then link the destination's groups to the source's groups and nullify the source.
+		// If the source has more unused memory spaces in the back group than the destination, swap them before processing to reduce the number of locations added to a free list and also subsequent jumps during iteration.
+
+		assert(&source != this);
+
+		if (source.total_size == 0)
+		{
+			return;
+		}
+		else if (total_size == 0)
+		{
+			if PLF_CONSTEXPR (generational) // Handles may refer to this colony's retained groups, so keep them as unused groups instead of deallocating them
+			{
+				swap(source);
+
+				if (source.begin_iterator.group_pointer != NULL)
+				{
+					source.add_group_to_unused_groups_list(source.begin_iterator.group_pointer);
+				}
+
+				take_unused_groups(source);
+				source.blank();
+				return;
+			}
+
+			#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+				*this = std::move(source);
+			#else
+				reset();
+				swap(source);
+			#endif
+
+			return;
+		}
+
+		// If there's more unused element locations in back memory block of destination than in back memory block of source, swap with source to reduce number of skipped elements during iteration, and reduce size of free-list:
+		if ((reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) > (reinterpret_cast<aligned_pointer_type>(source.end_iterator.group_pointer->skipfield) - source.end_iterator.element_pointer))
+		{
+			swap(source);
+		}
+
+
+		// Throw if incompatible group capacity found:
+		if (source.tuple_allocator_pair.min_group_capacity < tuple_allocator_pair.min_group_capacity || source.group_allocator_pair.max_group_capacity > group_allocator_pair.max_group_capacity)
+		{
+			for (group_pointer_type current_group = source.begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			{
+				if (current_group->capacity < tuple_allocator_pair.min_group_capacity || current_group->capacity > group_allocator_pair.max_group_capacity)
+				{
+					throw std::length_error("A source memory block capacity is outside of the destination's minimum or maximum memory block capacity limits - please change either the source or the destination's min/max block capacity limits using reshape() before calling splice() in this case");
+				}
+			}
+		}
+
+
+		// Add source list of groups-with-erasures to destination list of groups-with-erasures:
+		if (source.groups_with_erasures_list_head != NULL)
+		{
+			if (groups_with_erasures_list_head != NULL)
+			{
+				group_pointer_type tail_group = groups_with_erasures_list_head;
+
+				while (tail_group->erasures_list_next_group != NULL)
+				{
+					tail_group = tail_group->erasures_list_next_group;
+				}
+
+				tail_group->erasures_list_next_group = source.groups_with_erasures_list_head;
+			}
+			else
+			{
+				groups_with_erasures_list_head = source.groups_with_erasures_list_head;
+			}
+		}
+
+
+		const skipfield_type distance_to_end = static_cast<skipfield_type>(reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer);
+
+		if (distance_to_end != 0) // 0 == edge case
+		{	 // Mark unused element memory locations from back group as skipped/erased:
+
+			// Update skipfield:
+			const skipfield_type previous_node_value = *(end_iterator.skipfield_pointer - 1);
+			end_iterator.group_pointer->last_endpoint = reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield);
+
+			if (previous_node_value == 0) // no previous skipblock
+			{
+				*end_iterator.skipfield_pointer = distance_to_end;
+				*(end_iterator.skipfield_pointer + distance_to_end - 1) = distance_to_end;
+
+				const skipfield_type index = static_cast<skipfield_type>(end_iterator.element_pointer - end_iterator.group_pointer->elements);
+
+				if (end_iterator.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+				{
+					*(reinterpret_cast<skipfield_pointer_type>(end_iterator.group_pointer->elements + end_iterator.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
+				}
+				else
+				{
+					end_iterator.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
+					groups_with_erasures_list_head = end_iterator.group_pointer;
+				}
+
+				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer)) = end_iterator.group_pointer->free_list_head;
+				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
+				end_iterator.group_pointer->free_list_head = index;
+			}
+			else
+			{ // update previous skipblock, no need to update free list:
+				*(end_iterator.skipfield_pointer - previous_node_value) = *(end_iterator.skipfield_pointer + distance_to_end - 1) = static_cast<skipfield_type>(previous_node_value + distance_to_end);
+			}
+		}
+
+
+		// Update subsequent group numbers:
+		group_pointer_type current_group = source.begin_iterator.group_pointer;
+		size_type current_group_number = end_iterator.group_pointer->group_number;
+
+		do
+		{
+			current_group->group_number = ++current_group_number;
+			current_group = current_group->next_group;
+		} while (current_group != NULL);
+
+
+		// Join the destination and source group chains:
+		end_iterator.group_pointer->next_group = source.begin_iterator.group_pointer;
+		source.begin_iterator.group_pointer->previous_group = end_iterator.group_pointer;
+		end_iterator = source.end_iterator;
+		total_size += source.total_size;
+
+		if PLF_CONSTEXPR (generational) // Handles may refer to the source's unused groups, so keep them instead of deallocating them
+		{
+			take_unused_groups(source);
+		}
+		else
+		{
+			source.trim();
+		}
+
+		total_capacity += source.total_capacity;
+		source.blank();
+	}
+
+
+
+private:
+
+	// Moves the source's unused groups onto this colony's unused groups list. The caller is responsible for transferring their capacity:
+	void take_unused_groups(colony &source) PLF_NOEXCEPT
+	{
+		if (source.unused_groups_head == NULL)
+		{
+			return;
+		}
+
+		group_pointer_type tail_group = source.unused_groups_head;
+
+		while (tail_group->next_group != NULL)
+		{
+			tail_group = tail_group->next_group;
+		}
+
+		tail_group->next_group = unused_groups_head;
+		unused_groups_head = source.unused_groups_head;
+		source.unused_groups_head = NULL;
+	}
+
+
+
+public:
+
+
+
+	// Allows insertion from multiple threads at once without locking. Each thread inserts into its own staging colony, obtained via local(slot) using a slot number unique to that thread (eg. the thread's index within a thread pool). The staging colonies share the destination's allocator and block capacity limits, and are spliced into the destination when merge() is called or the inserter is destroyed. The destination must not be accessed while insertion is taking place, and merge() must not be called concurrently with insertion. An inserter can be reused after merge():
+	class concurrent_inserter : private allocator_type
+	{
+	private:
+		#if defined(PLF_ALIGNMENT_SUPPORT) && defined(__cpp_aligned_new) // ie. allocators honour over-aligned types
+			struct alignas(64) staging_area // Prevents the members of neighbouring colonies sharing a cache line (false sharing)
+			{
+				colony staging;
+
+				explicit staging_area(const colony &prototype):
+					staging(prototype)
+				{}
+			};
+		#else
+			struct staging_area
+			{
+				colony staging;
+				char padding[64]; // Prevents the members of neighbouring colonies sharing a cache line (false sharing)
+
+				explicit staging_area(const colony &prototype):
+					staging(prototype),
+					padding()
+				{}
+			};
+		#endif
+
+		#ifdef PLF_ALLOCATOR_TRAITS_SUPPORT
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<staging_area>	staging_allocator_type;
+			typedef typename std::allocator_traits<staging_allocator_type>::pointer							staging_pointer_type;
+		#else
+			typedef typename allocator_type::template rebind<staging_area>::other	staging_allocator_type;
+			typedef typename staging_allocator_type::pointer							staging_pointer_type;
+		#endif
+
+		colony &destination;
+		staging_pointer_type staging_areas;
+		const size_type number_of_slots;
+
+		concurrent_inserter(const concurrent_inserter &source); // Not copyable
+		concurrent_inserter & operator = (const concurrent_inserter &source);
+
+	public:
+		concurrent_inserter(colony &destination_colony, const size_type slots):
+			allocator_type(destination_colony.get_allocator()),
+			destination(destination_colony),
+			staging_areas(NULL),
+			number_of_slots(slots)
+		{
+			if (number_of_slots == 0)
+			{
+				return;
+			}
+
+			const colony prototype(destination.block_limits(), destination.get_allocator());
+			staging_allocator_type staging_allocator(*this);
+			staging_areas = PLF_ALLOCATE(staging_allocator_type, staging_allocator, number_of_slots, 0);
+			size_type current = 0;
+
+			try
+			{
+				for (; current != number_of_slots; ++current)
+				{
+					#ifdef PLF_VARIADICS_SUPPORT
+						PLF_CONSTRUCT(staging_allocator_type, staging_allocator, staging_areas + current, prototype);
+					#else
+						PLF_CONSTRUCT(staging_allocator_type, staging_allocator, staging_areas + current, staging_area(prototype));
+					#endif
+				}
+			}
+			catch (...)
+			{
+				while (current != 0)
+				{
+					PLF_DESTROY(staging_allocator_type, staging_allocator, staging_areas + --current);
+				}
+
+				PLF_DEALLOCATE(staging_allocator_type, staging_allocator, staging_areas, number_of_slots);
+				throw;
+			}
+		}
+
+
+
+		~concurrent_inserter()
+		{
+			if (staging_areas == NULL)
+			{
+				return;
+			}
+
+			merge();
+			staging_allocator_type staging_allocator(*this);
+
+			for (size_type current = 0; current != number_of_slots; ++current)
+			{
+				PLF_DESTROY(staging_allocator_type, staging_allocator, staging_areas + current);
+			}
+
+			PLF_DEALLOCATE(staging_allocator_type, staging_allocator, staging_areas, number_of_slots);
+		}
+
+
+
+		inline colony & local(const size_type slot) PLF_NOEXCEPT
+		{
+			assert(slot < number_of_slots);
+			return staging_areas[slot].staging;
+		}
+
+
+
+		inline size_type slots() const PLF_NOEXCEPT
+		{
+			return number_of_slots;
+		}
+
+
+
+		// Splices all staging colonies into the destination, in slot order. The partially-filled back group of each staging colony becomes erased (reusable) locations in the destination:
+		void merge()
+		{
+			for (size_type current = 0; current != number_of_slots; ++current)
+			{
+				destination.splice(staging_areas[current].staging);
+			}
+		}
+	};
+
+
+
+	// Collects iterators via erase_later() and erases them all in one go via flush_erasures(), which processes each affected group once - merging the new erasures with existing skipblocks and rebuilding the group's free list in a single pass, rather than updating them once per element. Groups which become empty are removed in bulk via range-erase. Several queues (eg. one per thread) may collect erasures for the same colony concurrently, provided the colony is not modified meanwhile; flushes must not run concurrently. Queued iterators are invalidated by anything which would invalidate them normally, including another queue's flush. Any remaining erasures are flushed when the queue is destroyed:
+	class erasure_queue : private allocator_type
+	{
+	private:
+		#ifdef PLF_ALLOCATOR_TRAITS_SUPPORT
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<const_iterator>	iterator_allocator_type;
+			typedef typename std::allocator_traits<iterator_allocator_type>::pointer								iterator_pointer_type;
+		#else
+			typedef typename allocator_type::template rebind<const_iterator>::other	iterator_allocator_type;
+			typedef typename iterator_allocator_type::pointer							iterator_pointer_type;
+		#endif
+
+		colony &target;
+		iterator_pointer_type queued;
+		size_type queued_size, queued_capacity;
+
+		erasure_queue(const erasure_queue &source); // Not copyable
+		erasure_queue & operator = (const erasure_queue &source);
+
+	public:
+		explicit erasure_queue(colony &target_colony):
+			allocator_type(target_colony.get_allocator()),
+			target(target_colony),
+			queued(NULL),
+			queued_size(0),
+			queued_capacity(0)
+		{}
+
+
+
+		~erasure_queue()
+		{
+			flush_erasures();
+
+			if (queued != NULL)
+			{
+				iterator_allocator_type iterator_allocator(*this);
+				PLF_DEALLOCATE(iterator_allocator_type, iterator_allocator, queued, queued_capacity);
+			}
+		}
+
+
+
+		void erase_later(const const_iterator &it)
+		{
+			assert(it.group_pointer != NULL && it.element_pointer != it.group_pointer->last_endpoint); // ie. not uninitialized iterator or end()
+			iterator_allocator_type iterator_allocator(*this);
+
+			if (queued_size == queued_capacity)
+			{
+				const size_type new_capacity = (queued_capacity == 0) ? 64 : queued_capacity * 2;
+				const iterator_pointer_type new_queued = PLF_ALLOCATE(iterator_allocator_type, iterator_allocator, new_capacity, 0);
+
+				if (queued != NULL)
+				{
+					for (size_type current = 0; current != queued_size; ++current) // iterators are trivially destructible, so no destruction of the old array is necessary
+					{
+						PLF_CONSTRUCT(iterator_allocator_type, iterator_allocator, new_queued + current, queued[current]);
+					}
+
+					PLF_DEALLOCATE(iterator_allocator_type, iterator_allocator, queued, queued_capacity);
+				}
+
+				queued = new_queued;
+				queued_capacity = new_capacity;
+			}
+
+			PLF_CONSTRUCT(iterator_allocator_type, iterator_allocator, queued + queued_size++, it);
+		}
+
+
+
+		// Returns the number of elements erased - duplicate iterators are only erased once:
+		size_type flush_erasures()
+		{
+			if (queued_size == 0)
+			{
+				return 0;
+			}
+
+			const size_type number_erased = target.batch_erase(&*queued, &*queued + queued_size);
+			queued_size = 0;
+			return number_erased;
+		}
+
+
+
+		inline size_type size() const PLF_NOEXCEPT
+		{
+			return queued_size;
+		}
+
+
+
+		inline void clear() PLF_NOEXCEPT
+		{
+			queued_size = 0;
+		}
+	};
+
+
+
+	// Maps between iterators and element indexes (ie. positions in iteration order) in O(log number of groups) time, plus a skipfield walk within the target group when that group has erasures. Holds each group's number and the number of elements preceding it, in iteration order - group numbers are ascending but may be non-contiguous (eg. after a range-erase), so a group's entry is found by binary search. Any insertion, erasure or other operation which changes the target colony's size or groups invalidates the index, after which it must be rebuilt (in O(number of groups) time) via rebuild() before further use:
+	class position_index : private allocator_type
+	{
+	private:
+		struct group_entry
+		{
+			group_pointer_type group;
+			size_type group_number, preceding_elements;
+		};
+
+		#ifdef PLF_ALLOCATOR_TRAITS_SUPPORT
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group_entry>	entry_allocator_type;
+			typedef typename std::allocator_traits<entry_allocator_type>::pointer							entry_pointer_type;
+		#else
+			typedef typename allocator_type::template rebind<group_entry>::other	entry_allocator_type;
+			typedef typename entry_allocator_type::pointer						entry_pointer_type;
+		#endif
+
+		const colony &target;
+		entry_pointer_type entries;
+		size_type number_of_entries, entries_capacity;
+
+		position_index(const position_index &source); // Not copyable
+		position_index & operator = (const position_index &source);
+
+	public:
+		explicit position_index(const colony &target_colony):
+			allocator_type(target_colony.get_allocator()),
+			target(target_colony),
+			entries(NULL),
+			number_of_entries(0),
+			entries_capacity(0)
+		{
+			rebuild();
+		}
+
+
+
+		~position_index()
+		{
+			if (entries != NULL)
+			{
+				entry_allocator_type entry_allocator(*this);
+				PLF_DEALLOCATE(entry_allocator_type, entry_allocator, entries, entries_capacity);
+			}
+		}
+
+
+
+		void rebuild()
+		{
+			number_of_entries = 0;
+
+			if (target.total_size == 0)
+			{
+				return;
+			}
+
+			size_type number_of_groups = 0;
+
+			for (group_pointer_type current = target.begin_iterator.group_pointer; current != NULL; current = current->next_group)
+			{
+				++number_of_groups;
+			}
+
+			if (number_of_groups > entries_capacity)
+			{
+				entry_allocator_type entry_allocator(*this);
+				const entry_pointer_type new_entries = PLF_ALLOCATE(entry_allocator_type, entry_allocator, number_of_groups, 0); // group_entry is trivial, so no construction or destruction is necessary
+
+				if (entries != NULL)
 				{
-					end_iterator.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
-					groups_with_erasures_list_head = end_iterator.group_pointer;
+					PLF_DEALLOCATE(entry_allocator_type, entry_allocator, entries, entries_capacity);
 				}
 
-				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer)) = end_iterator.group_pointer->free_list_head;
-				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
-				end_iterator.group_pointer->free_list_head = index;
+				entries = new_entries;
+				entries_capacity = number_of_groups;
 			}
-			else
-			{ // update previous skipblock, no need to update free list:
-				*(end_iterator.skipfield_pointer - previous_node_value) = *(end_iterator.skipfield_pointer + distance_to_end - 1) = static_cast<skipfield_type>(previous_node_value + distance_to_end);
+
+			size_type preceding_elements = 0;
+
+			for (group_pointer_type current = target.begin_iterator.group_pointer; current != NULL; current = current->next_group, ++number_of_entries)
+			{
+				entries[number_of_entries].group = current;
+				entries[number_of_entries].group_number = current->group_number;
+				entries[number_of_entries].preceding_elements = preceding_elements;
+				preceding_elements += current->size;
 			}
 		}
 
 
-		// Update subsequent group numbers:
-		group_pointer_type current_group = source.begin_iterator.group_pointer;
-		size_type current_group_number = end_iterator.group_pointer->group_number;
 
-		do
+		// Returns the index of the element it points to, or size() for end():
+		size_type get_index(const const_iterator &it) const PLF_NOEXCEPT
 		{
-			current_group->group_number = ++current_group_number;
-			current_group = current_group->next_group;
-		} while (current_group != NULL);
+			assert(it.group_pointer != NULL);
 
+			if (number_of_entries == 0) // ie. empty colony, so it == end()
+			{
+				return 0;
+			}
 
-		// Join the destination and source group chains:
-		end_iterator.group_pointer->next_group = source.begin_iterator.group_pointer;
-		source.begin_iterator.group_pointer->previous_group = end_iterator.group_pointer;
-		end_iterator = source.end_iterator;
-		total_size += source.total_size;
-		total_capacity += source.total_capacity;
+			const group_pointer_type group_p = it.group_pointer;
+			size_type lower = 0, upper = number_of_entries;
 
-		// Remove source unused groups:
-		source.trim();
-		source.blank();
-	}
+			while (upper - lower > 1) // Find the last group whose number is <= the iterator's group's number
+			{
+				const size_type middle = lower + ((upper - lower) >> 1);
+
+				if (entries[middle].group_number <= group_p->group_number)
+				{
+					lower = middle;
+				}
+				else
+				{
+					upper = middle;
+				}
+			}
+
+			assert(entries[lower].group == group_p); // Index is not stale
+
+			const size_type preceding_elements = entries[lower].preceding_elements;
+
+			if (group_p->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. no erasures in group
+			{
+				return preceding_elements + static_cast<size_type>(it.element_pointer - group_p->elements);
+			}
+
+			return preceding_elements + static_cast<size_type>(count_skipfield(group_p->skipfield + *(group_p->skipfield), it.skipfield_pointer));
+		}
+
+
+
+		// Returns an iterator to the element at index, or end() if index >= size():
+		const_iterator get_iterator(const size_type index) const
+		{
+			if (index >= target.total_size)
+			{
+				return target.cend();
+			}
+
+			size_type lower = 0, upper = number_of_entries;
+
+			while (upper - lower > 1) // Find the last group whose preceding element count is <= index
+			{
+				const size_type middle = lower + ((upper - lower) >> 1);
+
+				if (entries[middle].preceding_elements <= index)
+				{
+					lower = middle;
+				}
+				else
+				{
+					upper = middle;
+				}
+			}
+
+			const group_pointer_type group_p = entries[lower].group;
+			const size_type offset = index - entries[lower].preceding_elements;
+
+			if (group_p->free_list_head == std::numeric_limits<skipfield_type>::max())
+			{
+				return const_iterator(group_p, group_p->elements + offset, group_p->skipfield + offset);
+			}
+
+			const_iterator it(group_p, group_p->elements + *(group_p->skipfield), group_p->skipfield + *(group_p->skipfield));
+			advance(it, offset);
+			return it;
+		}
+	};
 
 
 
@@ -4482,102 +6392,373 @@ private:
 
 
 
-	template <class comparison_function>
-	struct sort_dereferencer
-	{
-		comparison_function stored_instance;
+	template <class comparison_function>
+	struct sort_dereferencer
+	{
+		comparison_function stored_instance;
+
+		explicit sort_dereferencer(const comparison_function &function_instance):
+			stored_instance(function_instance)
+		{}
+
+		bool operator() (const item_index_tuple first, const item_index_tuple second)
+		{
+			return stored_instance(*(first.original_location), *(second.original_location));
+		}
+	};
+
+
+
+	// The element which ends up at position N of a sort is the one originally at sort_array[N].original_index, so cold values can be permuted via a copy, before reorder_elements changes the indexes:
+	void reorder_cold_values(const tuple_pointer_type sort_array)
+	{
+		cold_allocator_type cold_allocator(*this);
+		const cold_pointer_type original_values = PLF_ALLOCATE(cold_allocator_type, cold_allocator, total_size, NULL);
+		size_type index = 0;
+
+		for (const_iterator current = begin_iterator; current != end_iterator; ++current, ++index)
+		{
+			original_values[index] = *cold_location(current);
+		}
+
+		index = 0;
+
+		for (const_iterator current = begin_iterator; current != end_iterator; ++current, ++index)
+		{
+			*cold_location(current) = original_values[sort_array[index].original_index];
+		}
+
+		PLF_DEALLOCATE(cold_allocator_type, cold_allocator, original_values, total_size);
+	}
+
+
+
+	// Moves the elements into the order given by a sorted tuple array, following each cycle of the permutation so that every element is moved only once:
+	void reorder_elements(const tuple_pointer_type sort_array)
+	{
+		if PLF_CONSTEXPR (cold_traits::size != 0)
+		{
+			reorder_cold_values(sort_array);
+		}
+
+		size_type index = 0;
+
+		for (tuple_pointer_type current_tuple = sort_array; current_tuple != sort_array + total_size; ++current_tuple, ++index)
+		{
+			if (current_tuple->original_index != index)
+			{
+				#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+					element_type end_value = std::move(*(current_tuple->original_location));
+				#else
+					element_type end_value = *(current_tuple->original_location);
+				#endif
+
+				size_type destination_index = index;
+				size_type source_index = current_tuple->original_index;
+
+				do
+				{
+					#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+						*(sort_array[destination_index].original_location) = std::move(*(sort_array[source_index].original_location));
+					#else
+						*(sort_array[destination_index].original_location) = *(sort_array[source_index].original_location);
+					#endif
+
+					destination_index = source_index;
+					source_index = sort_array[destination_index].original_index;
+					sort_array[destination_index].original_index = destination_index;
+				} while (source_index != index);
+
+				#ifdef PLF_MOVE_SEMANTICS_SUPPORT
+					*(sort_array[destination_index].original_location) = std::move(end_value);
+				#else
+					*(sort_array[destination_index].original_location) = end_value;
+				#endif
+			}
+		}
+	}
+
+
+
+public:
+
+
+	template <class comparison_function>
+	void sort(comparison_function compare)
+	{
+		if (total_size < 2)
+		{
+			return;
+		}
+
+		tuple_pointer_type const sort_array = PLF_ALLOCATE(tuple_allocator_type, tuple_allocator_pair, total_size, NULL);
+		tuple_pointer_type tuple_pointer = sort_array;
+
+		// Construct pointers to all elements in the sequence:
+		size_type index = 0;
+
+		for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element, ++tuple_pointer, ++index)
+		{
+			#ifdef PLF_VARIADICS_SUPPORT
+				PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, tuple_pointer, &*current_element, index);
+			#else
+				PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, tuple_pointer, item_index_tuple(&*current_element, index));
+			#endif
+		}
+
+		// Now, sort the pointers by the values they point to (std::sort is default sort function if the macro below is not defined):
+		#ifndef PLF_SORT_FUNCTION
+			std::sort(sort_array, sort_array + total_size, sort_dereferencer<comparison_function>(compare));
+		#else
+			PLF_SORT_FUNCTION(sort_array, sort_array + total_size, sort_dereferencer<comparison_function>(compare));
+		#endif
+
+		// Sort the actual elements via the tuple array:
+		reorder_elements(sort_array);
+
+		PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, sort_array, total_size);
+	}
+
+
+
+	inline void sort()
+	{
+		sort(less());
+	}
+
+
+
+	#ifdef PLF_EXECUTION_POLICY_SUPPORT
+		// As above, but the tuple array is constructed group-by-group and sorted using the supplied execution policy (eg. std::execution::par). The final element reordering pass remains serial, as it follows permutation cycles which may span the whole colony. PLF_SORT_FUNCTION is not used by this overload:
+		template <class execution_policy, class comparison_function>
+		void sort(execution_policy &&policy, comparison_function compare)
+		{
+			if (total_size < 2)
+			{
+				return;
+			}
+
+			typedef std::pair<group_pointer_type, size_type> group_index_type; // A group and the index of its first element within the sequence
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group_index_type> group_index_allocator_type;
+			typedef typename std::allocator_traits<group_index_allocator_type>::pointer group_index_pointer_type;
+
+			size_type number_of_groups = 0; // Group numbers may be non-contiguous after a range-erase, so count by walking the chain
+
+			for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			{
+				++number_of_groups;
+			}
+
+			tuple_pointer_type const sort_array = PLF_ALLOCATE(tuple_allocator_type, tuple_allocator_pair, total_size, NULL);
+
+			try
+			{
+				group_index_allocator_type group_index_allocator(*this);
+				const group_index_pointer_type group_indexes = std::allocator_traits<group_index_allocator_type>::allocate(group_index_allocator, number_of_groups);
+				group_index_type *group_indexes_end = &*group_indexes;
+				size_type first_index = 0;
+
+				for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group, ++group_indexes_end)
+				{
+					std::allocator_traits<group_index_allocator_type>::construct(group_index_allocator, group_indexes_end, current_group, first_index);
+					first_index += current_group->size;
+				}
+
+				// Construct pointers to all elements in the sequence, one task per group:
+				try
+				{
+					std::for_each(policy, &*group_indexes, group_indexes_end, [this, sort_array](const group_index_type &group_index)
+					{
+						const group_pointer_type current_group = group_index.first;
+						iterator current_element(current_group, current_group->elements + *(current_group->skipfield), current_group->skipfield + *(current_group->skipfield));
+						tuple_pointer_type tuple_pointer = sort_array + group_index.second;
+
+						for (size_type index = group_index.second, end_index = group_index.second + current_group->size; index != end_index; ++current_element, ++tuple_pointer, ++index)
+						{
+							PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, tuple_pointer, &*current_element, index);
+						}
+					});
+				}
+				catch (...)
+				{
+					std::allocator_traits<group_index_allocator_type>::deallocate(group_index_allocator, group_indexes, number_of_groups);
+					throw;
+				}
+
+				std::allocator_traits<group_index_allocator_type>::deallocate(group_index_allocator, group_indexes, number_of_groups);
+
+				std::sort(std::forward<execution_policy>(policy), sort_array, sort_array + total_size, sort_dereferencer<comparison_function>(compare));
+
+				reorder_elements(sort_array);
+			}
+			catch (...)
+			{
+				PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, sort_array, total_size);
+				throw;
+			}
+
+			PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, sort_array, total_size);
+		}
+	#endif
+
+
+
+	#ifdef PLF_TYPE_TRAITS_SUPPORT
+	private:
 
-		explicit sort_dereferencer(const comparison_function &function_instance):
-			stored_instance(function_instance)
-		{}
+		template <class key_type>
+		struct radix_sortable // ie. integers, and 32/64-bit IEEE floating-point numbers, can be ordered by their (transformed) bit patterns
+		{
+			static const bool value = sizeof(key_type) <= sizeof(unsigned long long) && (std::is_integral<key_type>::value || (std::is_floating_point<key_type>::value && std::numeric_limits<key_type>::is_iec559 && (sizeof(key_type) == 4 || sizeof(key_type) == 8)));
+		};
 
-		bool operator() (const item_index_tuple first, const item_index_tuple second)
+
+
+		// Transforms an integral key into an unsigned integer with the same ordering, by flipping the sign bit of signed types:
+		template <class unsigned_key_type, class key_type>
+		static unsigned_key_type radix_key(const key_type key, std::false_type) PLF_NOEXCEPT
 		{
-			return stored_instance(*(first.original_location), *(second.original_location));
+			return static_cast<unsigned_key_type>(static_cast<unsigned_key_type>(key) ^ (std::is_signed<key_type>::value ? static_cast<unsigned_key_type>(static_cast<unsigned_key_type>(1) << (sizeof(key_type) * 8 - 1)) : 0));
 		}
-	};
 
 
 
-public:
+		// Transforms a floating-point key into an unsigned integer with the same ordering, by flipping all the bits of negative numbers and the sign bit of positive numbers. Note: -0.0 will order before 0.0:
+		template <class unsigned_key_type, class key_type>
+		static unsigned_key_type radix_key(const key_type key, std::true_type) PLF_NOEXCEPT
+		{
+			unsigned_key_type bits;
+			std::memcpy(&bits, &key, sizeof(key_type));
+			const unsigned_key_type sign_bit = static_cast<unsigned_key_type>(static_cast<unsigned_key_type>(1) << (sizeof(key_type) * 8 - 1));
+			return (bits & sign_bit) ? static_cast<unsigned_key_type>(~bits) : static_cast<unsigned_key_type>(bits | sign_bit);
+		}
 
 
-	template <class comparison_function>
-	void sort(comparison_function compare)
-	{
-		if (total_size < 2)
+
+		template <class key_extractor_type>
+		struct key_comparer
 		{
-			return;
-		}
+			key_extractor_type extractor;
 
-		tuple_pointer_type const sort_array = PLF_ALLOCATE(tuple_allocator_type, tuple_allocator_pair, total_size, NULL);
-		tuple_pointer_type tuple_pointer = sort_array;
+			explicit key_comparer(const key_extractor_type &extractor_instance):
+				extractor(extractor_instance)
+			{}
 
-		// Construct pointers to all elements in the sequence:
-		size_type index = 0;
+			bool operator() (const element_type &first, const element_type &second)
+			{
+				return extractor(first) < extractor(second);
+			}
+		};
 
-		for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element, ++tuple_pointer, ++index)
+
+
+		template <class key_type, class key_extractor_type>
+		void sort_by_key_impl(key_extractor_type &key_extractor, std::false_type) // Non-arithmetic key, or one which can't be radix sorted - use the comparison sort
 		{
-			#ifdef PLF_VARIADICS_SUPPORT
-				PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, tuple_pointer, &*current_element, index);
-			#else
-				PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, tuple_pointer, item_index_tuple(&*current_element, index));
-			#endif
+			sort(key_comparer<key_extractor_type>(key_extractor));
 		}
 
-		// Now, sort the pointers by the values they point to (std::sort is default sort function if the macro below is not defined):
-		#ifndef PLF_SORT_FUNCTION
-			std::sort(sort_array, sort_array + total_size, sort_dereferencer<comparison_function>(compare));
-		#else
-			PLF_SORT_FUNCTION(sort_array, sort_array + total_size, sort_dereferencer<comparison_function>(compare));
-		#endif
 
-		// Sort the actual elements via the tuple array:
-		index = 0;
 
-		for (tuple_pointer_type current_tuple = sort_array; current_tuple != tuple_pointer; ++current_tuple, ++index)
+		template <class key_type, class key_extractor_type>
+		void sort_by_key_impl(key_extractor_type &key_extractor, std::true_type) // LSD radix sort of the tuples, one byte of the key per pass
 		{
-			if (current_tuple->original_index != index)
+			typedef typename choose<sizeof(key_type) == 1, unsigned char, typename choose<sizeof(key_type) == 2, unsigned short, typename choose<sizeof(key_type) == 4, unsigned int, unsigned long long>::type>::type>::type unsigned_key_type;
+
+			// The tuples and transformed keys are each double-buffered, with passes alternating between buffers:
+			tuple_pointer_type const tuple_buffers = PLF_ALLOCATE(tuple_allocator_type, tuple_allocator_pair, total_size * 2, NULL);
+			uchar_allocator_type uchar_allocator(*this);
+			unsigned_key_type *key_buffers;
+
+			try
 			{
-				#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-					element_type end_value = std::move(*(current_tuple->original_location));
-				#else
-					element_type end_value = *(current_tuple->original_location);
-				#endif
+				key_buffers = reinterpret_cast<unsigned_key_type *>(PLF_ALLOCATE(uchar_allocator_type, uchar_allocator, total_size * 2 * sizeof(unsigned_key_type), NULL));
+			}
+			catch (...)
+			{
+				PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, tuple_buffers, total_size * 2);
+				throw;
+			}
 
-				size_type destination_index = index;
-				size_type source_index = current_tuple->original_index;
+			try // A key extractor or element move may throw
+			{
+				tuple_pointer_type source_tuples = tuple_buffers, destination_tuples = tuple_buffers + total_size;
+				unsigned_key_type *source_keys = key_buffers, *destination_keys = key_buffers + total_size;
 
-				do
+				// Histograms for every byte of the key are gathered in a single pass over the elements, and passes where all keys share the same byte value are skipped:
+				size_type counts[sizeof(key_type)][256] = {};
+				size_type index = 0;
+
+				for (iterator current_element = begin_iterator; current_element != end_iterator; ++current_element, ++index)
 				{
-					#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-						*(sort_array[destination_index].original_location) = std::move(*(sort_array[source_index].original_location));
-					#else
-						*(sort_array[destination_index].original_location) = *(sort_array[source_index].original_location);
-					#endif
+					PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, source_tuples + index, item_index_tuple(&*current_element, index));
+					const unsigned_key_type key = radix_key<unsigned_key_type>(static_cast<key_type>(key_extractor(*current_element)), std::is_floating_point<key_type>());
+					source_keys[index] = key;
 
-					destination_index = source_index;
-					source_index = sort_array[destination_index].original_index;
-					sort_array[destination_index].original_index = destination_index;
-				} while (source_index != index);
+					for (unsigned int byte = 0; byte != sizeof(key_type); ++byte)
+					{
+						++counts[byte][(key >> (byte * 8)) & 255];
+					}
+				}
 
-				#ifdef PLF_MOVE_SEMANTICS_SUPPORT
-					*(sort_array[destination_index].original_location) = std::move(end_value);
-				#else
-					*(sort_array[destination_index].original_location) = end_value;
-				#endif
+				for (unsigned int byte = 0; byte != sizeof(key_type); ++byte)
+				{
+					size_type * const offsets = counts[byte];
+					const unsigned int shift = byte * 8;
+
+					if (offsets[(*source_keys >> shift) & 255] == total_size) // All keys share this byte value, so this pass would not change the order
+					{
+						continue;
+					}
+
+					for (size_type digit = 0, offset = 0; digit != 256; ++digit) // Convert counts to starting offsets
+					{
+						const size_type count = offsets[digit];
+						offsets[digit] = offset;
+						offset += count;
+					}
+
+					for (index = 0; index != total_size; ++index)
+					{
+						const size_type destination_index = offsets[(source_keys[index] >> shift) & 255]++;
+						destination_keys[destination_index] = source_keys[index];
+						PLF_CONSTRUCT(tuple_allocator_type, tuple_allocator_pair, destination_tuples + destination_index, source_tuples[index]);
+					}
+
+					std::swap(source_keys, destination_keys);
+					std::swap(source_tuples, destination_tuples);
+				}
+
+				reorder_elements(source_tuples);
+			}
+			catch (...)
+			{
+				PLF_DEALLOCATE(uchar_allocator_type, uchar_allocator, reinterpret_cast<unsigned char *>(key_buffers), total_size * 2 * sizeof(unsigned_key_type));
+				PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, tuple_buffers, total_size * 2);
+				throw;
 			}
+
+			PLF_DEALLOCATE(uchar_allocator_type, uchar_allocator, reinterpret_cast<unsigned char *>(key_buffers), total_size * 2 * sizeof(unsigned_key_type));
+			PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, tuple_buffers, total_size * 2);
 		}
 
-		PLF_DEALLOCATE(tuple_allocator_type, tuple_allocator_pair, sort_array, total_size);
-	}
 
 
+	public:
 
-	inline void sort()
-	{
-		sort(less());
-	}
+		// Sorts elements by the key returned by key_extractor(element), using the < operator on keys. Integral and floating-point keys are sorted via a stable radix sort, other key types via sort():
+		template <class key_extractor_type>
+		void sort_by_key(key_extractor_type key_extractor)
+		{
+			if (total_size < 2)
+			{
+				return;
+			}
+
+			typedef typename std::decay<decltype(key_extractor(*begin_iterator))>::type key_type;
+			sort_by_key_impl<key_type>(key_extractor, std::integral_constant<bool, radix_sortable<key_type>::value>());
+		}
+	#endif
 
 
 
@@ -4657,6 +6838,246 @@ public:
 
 
 
+	#ifdef PLF_TYPE_TRAITS_SUPPORT
+private:
+
+		struct snapshot_header
+		{
+			char magic[8];
+			unsigned int version, byte_order, element_size, allocation_size, skipfield_size, cold_size;
+			size_type number_of_groups, total_size;
+			skipfield_type min_group_capacity, max_group_capacity;
+		};
+
+		struct snapshot_group_header
+		{
+			skipfield_type capacity, size, last_endpoint_index, free_list_head;
+		};
+
+		inline void fill_snapshot_header(snapshot_header &header, const size_type number_of_groups) const PLF_NOEXCEPT
+		{
+			std::memset(static_cast<void *>(&header), 0, sizeof(snapshot_header)); // zero padding bytes, so that snapshots of identical colonies are identical
+			std::memcpy(header.magic, "plfcolny", 8);
+			header.version = 1;
+			header.byte_order = 0x01020304u;
+			header.element_size = static_cast<unsigned int>(sizeof(element_type));
+			header.allocation_size = static_cast<unsigned int>(sizeof(aligned_element_type));
+			header.skipfield_size = static_cast<unsigned int>(sizeof(skipfield_type));
+			header.cold_size = static_cast<unsigned int>(cold_traits::size);
+			header.number_of_groups = number_of_groups;
+			header.total_size = total_size;
+			header.min_group_capacity = tuple_allocator_pair.min_group_capacity;
+			header.max_group_capacity = group_allocator_pair.max_group_capacity;
+		}
+
+
+
+		// Checks a restored group's skipfield and free list against its header, so that a corrupt snapshot cannot produce a colony which fails on iteration, insertion or erasure. Skipfield nodes from the last endpoint onwards, including the final node, are zeroed by the group constructor rather than read:
+		static bool consistent_snapshot_group(const group_pointer_type the_group, const snapshot_group_header &group_header) PLF_NOEXCEPT
+		{
+			const skipfield_pointer_type skipfield = the_group->skipfield;
+			const size_type end_index = group_header.last_endpoint_index;
+			size_type number_of_elements = 0, number_of_skipblocks = 0;
+
+			for (size_type index = 0; index != end_index;)
+			{
+				const skipfield_type node = skipfield[index];
+
+				if (node == 0)
+				{
+					++number_of_elements;
+					++index;
+					continue;
+				}
+
+				// A skipblock's start and end nodes must match, and it must be followed by an element, as adjacent skipblocks are always merged:
+				if (node > end_index - index || skipfield[index + node - 1] != node || (index + node != end_index && skipfield[index + node] != 0))
+				{
+					return false;
+				}
+
+				++number_of_skipblocks;
+				index += node;
+			}
+
+			// Each free list entry must be the start of a skipblock, with a matching back link, and every skipblock must be on the free list:
+			size_type number_of_free_list_entries = 0;
+			skipfield_type previous_index = std::numeric_limits<skipfield_type>::max();
+
+			for (skipfield_type index = group_header.free_list_head; index != std::numeric_limits<skipfield_type>::max(); ++number_of_free_list_entries)
+			{
+				if (number_of_free_list_entries == number_of_skipblocks || index >= end_index || skipfield[index] == 0 || skipfield[index] > end_index - index || skipfield[index + skipfield[index] - 1] != skipfield[index] || (index != 0 && skipfield[index - 1] != 0))
+				{
+					return false;
+				}
+
+				const skipfield_pointer_type free_list_node = reinterpret_cast<skipfield_pointer_type>(the_group->elements + index);
+
+				if (*(free_list_node + 1) != previous_index)
+				{
+					return false;
+				}
+
+				previous_index = index;
+				index = *free_list_node;
+			}
+
+			return number_of_elements == group_header.size && number_of_free_list_entries == number_of_skipblocks;
+		}
+
+
+
+public:
+
+		// Writes a binary snapshot of the colony via write(const void *data, size_t number_of_bytes), which may be called any number of times. Each group's element memory block, skipfield, free list and cold values (if any) are written verbatim, in group order, up to the group's last_endpoint. Unused groups are not written. Only for trivially-copyable element types. The snapshot can only be restored by a colony of the same type, compiled for the same platform:
+		template <class write_function>
+		void snapshot(write_function write) const
+		{
+			PLF_STATIC_ASSERT(std::is_trivially_copyable<element_type>::value, "snapshot() requires a trivially-copyable element type");
+
+			size_type number_of_groups = 0; // Group numbers may be non-contiguous after a range-erase, so count by walking the chain
+
+			if (total_size != 0)
+			{
+				for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+				{
+					++number_of_groups;
+				}
+			}
+
+			snapshot_header header;
+			fill_snapshot_header(header, number_of_groups);
+			write(static_cast<const void *>(&header), sizeof(snapshot_header));
+
+			if (header.number_of_groups == 0)
+			{
+				return;
+			}
+
+			for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			{
+				snapshot_group_header group_header;
+				std::memset(static_cast<void *>(&group_header), 0, sizeof(snapshot_group_header));
+				group_header.capacity = current_group->capacity;
+				group_header.size = current_group->size;
+				group_header.last_endpoint_index = static_cast<skipfield_type>(current_group->last_endpoint - current_group->elements);
+				group_header.free_list_head = current_group->free_list_head;
+
+				write(static_cast<const void *>(&group_header), sizeof(snapshot_group_header));
+				write(static_cast<const void *>(&*(current_group->elements)), sizeof(aligned_element_type) * group_header.last_endpoint_index);
+				write(static_cast<const void *>(&*(current_group->skipfield)), sizeof(skipfield_type) * group_header.last_endpoint_index);
+
+				if (cold_traits::size != 0)
+				{
+					write(static_cast<const void *>(current_group->cold_values()), cold_traits::size * group_header.last_endpoint_index);
+				}
+			}
+		}
+
+
+
+		// Replaces the colony's contents with a snapshot written by snapshot(), via read(void *data, size_t number_of_bytes), which must either read exactly number_of_bytes or throw. Element memory blocks and skipfields are read directly into newly-allocated groups, so the restore is bound by the speed of read() rather than by insertion. The colony takes on the snapshot's block capacity limits. Throws std::invalid_argument if the snapshot was not written by this colony type on this platform, or if its block capacity limits, group capacities, sizes, skipfields or free lists are inconsistent. If an exception is thrown, the colony is left unchanged:
+		template <class read_function>
+		void restore(read_function read)
+		{
+			PLF_STATIC_ASSERT(std::is_trivially_copyable<element_type>::value, "restore() requires a trivially-copyable element type");
+
+			snapshot_header header, expected;
+			read(static_cast<void *>(&header), sizeof(snapshot_header));
+			fill_snapshot_header(expected, 0);
+
+			if (std::memcmp(header.magic, expected.magic, 8) != 0 || header.version != expected.version || header.byte_order != expected.byte_order || header.element_size != expected.element_size || header.allocation_size != expected.allocation_size || header.skipfield_size != expected.skipfield_size || header.cold_size != expected.cold_size)
+			{
+				throw std::invalid_argument("Snapshot was not written by this colony type on this platform");
+			}
+
+			if (header.min_group_capacity < 2 || header.min_group_capacity > header.max_group_capacity)
+			{
+				throw std::invalid_argument("Inconsistent block capacity limits in snapshot");
+			}
+
+			colony restored(plf::colony_limits(header.min_group_capacity, header.max_group_capacity), get_allocator());
+
+			for (size_type group_number = 0; group_number != header.number_of_groups; ++group_number)
+			{
+				snapshot_group_header group_header;
+				read(static_cast<void *>(&group_header), sizeof(snapshot_group_header));
+
+				// Only the back group may have unused element memory locations past its last endpoint:
+				if (group_header.capacity < header.min_group_capacity || group_header.capacity > header.max_group_capacity || (group_number + 1 != header.number_of_groups && group_header.last_endpoint_index != group_header.capacity) || group_header.size == 0 || group_header.size > group_header.last_endpoint_index || group_header.last_endpoint_index > group_header.capacity || (group_header.free_list_head != std::numeric_limits<skipfield_type>::max() && group_header.free_list_head >= group_header.last_endpoint_index) || (group_header.free_list_head == std::numeric_limits<skipfield_type>::max()) != (group_header.size == group_header.last_endpoint_index))
+				{
+					throw std::invalid_argument("Inconsistent group in snapshot");
+				}
+
+				const group_pointer_type new_group = restored.allocate_new_group(group_header.capacity, restored.end_iterator.group_pointer);
+
+				try
+				{
+					read(static_cast<void *>(&*(new_group->elements)), sizeof(aligned_element_type) * group_header.last_endpoint_index);
+					read(static_cast<void *>(&*(new_group->skipfield)), sizeof(skipfield_type) * group_header.last_endpoint_index);
+
+					if (cold_traits::size != 0)
+					{
+						read(static_cast<void *>(new_group->cold_values()), cold_traits::size * group_header.last_endpoint_index);
+					}
+
+					if (!consistent_snapshot_group(new_group, group_header))
+					{
+						throw std::invalid_argument("Inconsistent skipfield or free list in snapshot");
+					}
+				}
+				catch (...)
+				{
+					restored.deallocate_group(new_group);
+					throw;
+				}
+
+				new_group->last_endpoint = new_group->elements + group_header.last_endpoint_index;
+				new_group->size = group_header.size;
+				new_group->free_list_head = group_header.free_list_head;
+
+				if (new_group->free_list_head != std::numeric_limits<skipfield_type>::max())
+				{
+					new_group->erasures_list_next_group = restored.groups_with_erasures_list_head;
+					restored.groups_with_erasures_list_head = new_group;
+				}
+
+				if (restored.end_iterator.group_pointer == NULL)
+				{
+					restored.begin_iterator.group_pointer = new_group;
+				}
+				else
+				{
+					restored.end_iterator.group_pointer->next_group = new_group;
+				}
+
+				restored.end_iterator.group_pointer = new_group;
+				restored.end_iterator.element_pointer = new_group->last_endpoint;
+				restored.end_iterator.skipfield_pointer = new_group->skipfield + group_header.last_endpoint_index;
+				restored.total_size += group_header.size;
+				restored.total_capacity += group_header.capacity;
+			}
+
+			if (restored.total_size != header.total_size)
+			{
+				throw std::invalid_argument("Inconsistent total size in snapshot");
+			}
+
+			if (restored.begin_iterator.group_pointer != NULL)
+			{
+				const group_pointer_type first_group = restored.begin_iterator.group_pointer;
+				restored.begin_iterator.element_pointer = first_group->elements + *(first_group->skipfield);
+				restored.begin_iterator.skipfield_pointer = first_group->skipfield + *(first_group->skipfield);
+			}
+
+			restored.set_growth_policy(growth_function.policy);
+			swap(restored);
+			absorb_allocation_counters(restored);
+		}
+	#endif
+
+
+
 
 	void swap(colony &source) PLF_NOEXCEPT_SWAP(allocator_type)
 	{
@@ -4669,6 +7090,10 @@ public:
 				std::memcpy(&temp, static_cast<void *>(this), sizeof(colony));
 				std::memcpy(static_cast<void *>(this), static_cast<void *>(&source), sizeof(colony));
 				std::memcpy(static_cast<void *>(&source), &temp, sizeof(colony));
+
+				#ifdef PLF_COLONY_ALLOCATION_COUNTERS
+					std::swap(allocation_counters, source.allocation_counters);
+				#endif
 			}
 			#ifdef PLF_MOVE_SEMANTICS_SUPPORT // Moving is probably going to be more efficient than copying, particularly if pointer types are non-trivial:
 				else if PLF_CONSTEXPR (std::is_move_assignable<group_pointer_type>::value && std::is_move_assignable<aligned_pointer_type>::value && std::is_move_assignable<skipfield_pointer_type>::value && std::is_move_constructible<group_pointer_type>::value && std::is_move_constructible<aligned_pointer_type>::value && std::is_move_constructible<skipfield_pointer_type>::value)
@@ -4703,6 +7128,8 @@ public:
 			source.total_capacity = swap_total_capacity;
 			source.tuple_allocator_pair.min_group_capacity = swap_min_group_capacity;
 			source.group_allocator_pair.max_group_capacity = swap_max_group_capacity;
+			std::swap(growth_reuses, source.growth_reuses);
+			std::swap(growth_function, source.growth_function);
 		}
 	}
 
@@ -4735,59 +7162,24 @@ struct colony_eq_to
 namespace std
 {
 
-	template <class element_type, class allocator_type, plf::colony_priority priority>
-	inline void swap (plf::colony<element_type, allocator_type, priority> &a, plf::colony<element_type, allocator_type, priority> &b) PLF_NOEXCEPT_SWAP(allocator_type)
+	template <class element_type, class allocator_type, plf::colony_priority priority, bool generational, class cold_type>
+	inline void swap (plf::colony<element_type, allocator_type, priority, generational, cold_type> &a, plf::colony<element_type, allocator_type, priority, generational, cold_type> &b) PLF_NOEXCEPT_SWAP(allocator_type)
 	{
 		a.swap(b);
 	}
 
 
 
-	template <class element_type, class allocator_type, plf::colony_priority priority, class predicate_function>
-	typename plf::colony<element_type, allocator_type, priority>::size_type erase_if(plf::colony<element_type, allocator_type, priority> &container, predicate_function predicate)
+	template <class element_type, class allocator_type, plf::colony_priority priority, bool generational, class cold_type, class predicate_function>
+	inline typename plf::colony<element_type, allocator_type, priority, generational, cold_type>::size_type erase_if(plf::colony<element_type, allocator_type, priority, generational, cold_type> &container, predicate_function predicate)
 	{
-		typedef typename plf::colony<element_type, allocator_type, priority> colony;
-		typedef typename colony::const_iterator	const_iterator;
-		typedef typename colony::size_type			size_type;
-		size_type count = 0;
-
-		for(const_iterator current = container.begin(), end = container.end(); current != end;)
-		{
-			if (predicate(*current))
-			{
-				const size_type original_count = ++count;
-				const_iterator last(++const_iterator(current));
-
-				while(last != end && predicate(*last))
-				{
-					++last;
-					++count;
-				}
-
-				if (count != original_count)
-				{
-					current = container.erase(current, last);
-				}
-				else
-				{
-					current = container.erase(current);
-				}
-
-				end = container.end();
-			}
-			else
-			{
-				++current;
-			}
-		}
-
-		return count;
+		return container.erase_if(predicate);
 	}
 
 
 
-	template <class element_type, class allocator_type, plf::colony_priority priority>
-	inline typename plf::colony<element_type, allocator_type, priority>::size_type erase(plf::colony<element_type, allocator_type, priority> &container, const element_type &value)
+	template <class element_type, class allocator_type, plf::colony_priority priority, bool generational, class cold_type>
+	inline typename plf::colony<element_type, allocator_type, priority, generational, cold_type>::size_type erase(plf::colony<element_type, allocator_type, priority, generational, cold_type> &container, const element_type &value)
 	{
 		return erase_if(container, plf::colony_eq_to<element_type>(value));
 	}
@@ -4796,6 +7188,8 @@ namespace std
 
 #undef PLF_MIN_BLOCK_CAPACITY
 #undef PLF_GROUP_ALIGNED_BLOCK_SIZE
+#undef PLF_COLD_BLOCK_BYTES
+#undef PLF_GENERATION_BLOCK_BYTES
 
 #undef PLF_FORCE_INLINE
 #undef PLF_ALIGNMENT_SUPPORT
@@ -4809,6 +7203,10 @@ namespace std
 #undef PLF_NOEXCEPT_MOVE_ASSIGN
 #undef PLF_CONSTEXPR
 #undef PLF_CPP20_SUPPORT
+#undef PLF_EXECUTION_POLICY_SUPPORT
+#undef PLF_SSE2_SUPPORT
+#undef PLF_AVX2_SUPPORT
+#undef PLF_PREFETCH
 #undef PLF_STATIC_ASSERT
 
 #undef PLF_CONSTRUCT
@@ -0,0 +1,301 @@
+// zLib license (https://www.zlib.net/zlib_license.html):
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// 	claim that you wrote the original software. If you use this software
+// 	in a product, an acknowledgement in the product documentation would be
+// 	appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+// 	misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+// A thread-safe block cache and allocator for recycling group memory between plf::colony instances. Requires C++11.
+
+#ifndef PLF_COLONY_BLOCK_POOL_H
+#define PLF_COLONY_BLOCK_POOL_H
+
+#include <cstddef> // size_t, NULL
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator_traits
+#include <mutex> // std::mutex, std::lock_guard
+#include <new> // operator new, std::bad_alloc, std::nothrow
+
+
+namespace plf
+{
+
+// A thread-safe cache of freed memory blocks which can be shared between any number of colonies via colony_pool_allocator. Blocks are cached by exact size and alignment - for a colony's groups, this means by element type and group capacity - so when one colony allocates a group of the same size as one another colony has freed, it is given that memory back without a call to the global allocator. Up to max_cached_bytes of freed blocks are retained; past that, blocks are freed immediately. Cached blocks are freed by release() or on destruction:
+class colony_block_pool
+{
+private:
+	struct free_block
+	{
+		free_block *next;
+	};
+
+	struct bucket
+	{
+		size_t size, alignment;
+		free_block *head;
+		bucket *next;
+	};
+
+	mutable std::mutex pool_mutex;
+	bucket *buckets;
+	size_t cached, max_cached;
+
+	colony_block_pool(const colony_block_pool &source); // Not copyable
+	colony_block_pool & operator = (const colony_block_pool &source);
+
+
+
+	static void * allocate_block(const size_t size, const size_t alignment)
+	{
+		#ifdef __cpp_aligned_new
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				return ::operator new(size, std::align_val_t(alignment));
+			}
+		#else
+			(void)alignment;
+		#endif
+
+		return ::operator new(size);
+	}
+
+
+
+	static void deallocate_block(void * const block, const size_t alignment) noexcept
+	{
+		#ifdef __cpp_aligned_new
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				::operator delete(block, std::align_val_t(alignment));
+				return;
+			}
+		#else
+			(void)alignment;
+		#endif
+
+		::operator delete(block);
+	}
+
+
+
+	// Must be called with the mutex locked. The found bucket is moved to the front of the list, as most programs only use a handful of block sizes at any one time:
+	bucket * find_bucket(const size_t size, const size_t alignment) noexcept
+	{
+		for (bucket *current = buckets, *previous = NULL; current != NULL; previous = current, current = current->next)
+		{
+			if (current->size == size && current->alignment == alignment)
+			{
+				if (previous != NULL)
+				{
+					previous->next = current->next;
+					current->next = buckets;
+					buckets = current;
+				}
+
+				return current;
+			}
+		}
+
+		return NULL;
+	}
+
+
+
+public:
+
+	explicit colony_block_pool(const size_t max_cached_bytes = 64 * 1024 * 1024) noexcept:
+		buckets(NULL),
+		cached(0),
+		max_cached(max_cached_bytes)
+	{}
+
+
+
+	~colony_block_pool() noexcept
+	{
+		release();
+
+		while (buckets != NULL)
+		{
+			bucket * const next = buckets->next;
+			delete buckets;
+			buckets = next;
+		}
+	}
+
+
+
+	void * allocate(const size_t size, const size_t alignment)
+	{
+		if (size >= sizeof(free_block)) // Smaller blocks cannot hold the free list link and are not cached
+		{
+			std::lock_guard<std::mutex> lock(pool_mutex);
+			bucket * const found = find_bucket(size, alignment);
+
+			if (found != NULL && found->head != NULL)
+			{
+				free_block * const block = found->head;
+				found->head = block->next;
+				cached -= size;
+				return static_cast<void *>(block);
+			}
+		}
+
+		return allocate_block(size, alignment);
+	}
+
+
+
+	void deallocate(void * const block, const size_t size, const size_t alignment) noexcept
+	{
+		if (size >= sizeof(free_block))
+		{
+			std::lock_guard<std::mutex> lock(pool_mutex);
+
+			if (cached + size <= max_cached)
+			{
+				bucket *found = find_bucket(size, alignment);
+
+				if (found == NULL)
+				{
+					found = new (std::nothrow) bucket;
+
+					if (found != NULL)
+					{
+						found->size = size;
+						found->alignment = alignment;
+						found->head = NULL;
+						found->next = buckets;
+						buckets = found;
+					}
+				}
+
+				if (found != NULL)
+				{
+					free_block * const freed = static_cast<free_block *>(block);
+					freed->next = found->head;
+					found->head = freed;
+					cached += size;
+					return;
+				}
+			}
+		}
+
+		deallocate_block(block, alignment);
+	}
+
+
+
+	// Frees all cached blocks:
+	void release() noexcept
+	{
+		std::lock_guard<std::mutex> lock(pool_mutex);
+
+		for (bucket *current = buckets; current != NULL; current = current->next)
+		{
+			while (current->head != NULL)
+			{
+				free_block * const next = current->head->next;
+				deallocate_block(static_cast<void *>(current->head), current->alignment);
+				current->head = next;
+			}
+		}
+
+		cached = 0;
+	}
+
+
+
+	size_t cached_bytes() const noexcept
+	{
+		std::lock_guard<std::mutex> lock(pool_mutex);
+		return cached;
+	}
+
+
+
+	// The pool used by default-constructed colony_pool_allocators. It is intentionally never destroyed, so that colonies with static storage duration can still return blocks to it during program exit:
+	static colony_block_pool & shared_pool()
+	{
+		static colony_block_pool * const pool = new colony_block_pool();
+		return *pool;
+	}
+};
+
+
+
+// Allocates from a colony_block_pool - the shared pool by default. Use as a colony's allocator_type to have its groups recycled between colonies, eg. plf::colony<int, plf::colony_pool_allocator<int> >:
+template <class element_type>
+class colony_pool_allocator
+{
+private:
+	colony_block_pool *pool;
+
+	template <class other_type> friend class colony_pool_allocator;
+
+public:
+	typedef element_type value_type;
+
+	colony_pool_allocator() noexcept:
+		pool(&colony_block_pool::shared_pool())
+	{}
+
+	explicit colony_pool_allocator(colony_block_pool &source_pool) noexcept:
+		pool(&source_pool)
+	{}
+
+	template <class other_type>
+	colony_pool_allocator(const colony_pool_allocator<other_type> &source) noexcept:
+		pool(source.pool)
+	{}
+
+
+
+	element_type * allocate(const size_t number_of_elements)
+	{
+		if (number_of_elements > std::numeric_limits<size_t>::max() / sizeof(element_type))
+		{
+			throw std::bad_alloc();
+		}
+
+		return static_cast<element_type *>(pool->allocate(number_of_elements * sizeof(element_type), alignof(element_type)));
+	}
+
+
+
+	void deallocate(element_type * const location, const size_t number_of_elements) noexcept
+	{
+		pool->deallocate(static_cast<void *>(location), number_of_elements * sizeof(element_type), alignof(element_type));
+	}
+
+
+
+	template <class other_type>
+	inline bool operator == (const colony_pool_allocator<other_type> &rh) const noexcept
+	{
+		return pool == rh.pool;
+	}
+
+
+
+	template <class other_type>
+	inline bool operator != (const colony_pool_allocator<other_type> &rh) const noexcept
+	{
+		return pool != rh.pool;
+	}
+};
+
+}
+
+#endif // PLF_COLONY_BLOCK_POOL_H
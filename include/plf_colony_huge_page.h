@@ -0,0 +1,354 @@
+// zLib license (https://www.zlib.net/zlib_license.html):
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// 	claim that you wrote the original software. If you use this software
+// 	in a product, an acknowledgement in the product documentation would be
+// 	appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+// 	misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+// A huge-page-backed arena and allocator for plf::colony groups. Requires C++11, and either Linux or C++17 aligned new.
+
+#ifndef PLF_COLONY_HUGE_PAGE_H
+#define PLF_COLONY_HUGE_PAGE_H
+
+#if defined(__linux__) || defined(__cpp_aligned_new)
+
+#include <cassert> // assert
+#include <cstddef> // size_t, NULL
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator_traits
+#include <mutex> // std::mutex, std::lock_guard
+#include <new> // operator new, std::bad_alloc, std::align_val_t
+
+#ifdef __linux__
+	#include <sys/mman.h> // mmap, munmap, madvise
+	#include <sys/syscall.h> // SYS_mbind
+	#include <unistd.h> // syscall
+#endif
+
+
+namespace plf
+{
+
+// Allocates memory from region-aligned, huge-page-backed memory regions (2MB by default), to reduce TLB misses when iterating over large colonies. On Linux, regions are requested via MAP_HUGETLB, falling back to transparent huge pages via madvise(MADV_HUGEPAGE) when no huge pages are reserved, and can be bound to a NUMA node. Elsewhere, regions are only region-aligned. Allocations larger than half a region are given their own mapping, rounded up to a whole number of regions. Smaller allocations, such as group structs, are packed into a shared region which is unmapped once all of its allocations have been freed. Using block_bytes() with colony::block_capacity_for_bytes() sizes groups so that each group's memory block fills one region exactly. Thread-safe:
+class colony_huge_page_arena
+{
+private:
+	struct region_header
+	{
+		size_t live_allocations, mapping_size;
+	};
+
+	static const size_t header_size = 64; // Keeps the allocation following the header cache-line-aligned
+
+	mutable std::mutex arena_mutex;
+	const size_t region_size;
+	const int numa_node;
+	char *current_region; // The shared region that small allocations are currently packed into
+	size_t current_offset;
+	bool hugetlb_unavailable;
+
+	colony_huge_page_arena(const colony_huge_page_arena &source); // Not copyable
+	colony_huge_page_arena & operator = (const colony_huge_page_arena &source);
+
+
+
+	static inline size_t round_up(const size_t value, const size_t multiple) noexcept
+	{
+		return ((value + multiple - 1) / multiple) * multiple;
+	}
+
+
+
+	char * map_region(const size_t mapping_size)
+	{
+		#ifdef __linux__
+			char *region = NULL;
+
+			if (!hugetlb_unavailable)
+			{
+				void * const mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+				if (mapping == MAP_FAILED) // ie. no huge pages reserved, or the system huge page size does not divide the mapping size - don't retry for subsequent regions
+				{
+					hugetlb_unavailable = true;
+				}
+				else if (reinterpret_cast<size_t>(mapping) % region_size != 0) // System huge page size is smaller than the region size
+				{
+					munmap(mapping, mapping_size);
+					hugetlb_unavailable = true;
+				}
+				else
+				{
+					region = static_cast<char *>(mapping);
+				}
+			}
+
+			if (region == NULL)
+			{
+				// Over-allocate, then trim the mapping to a region-aligned address:
+				void * const mapping = mmap(NULL, mapping_size + region_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if (mapping == MAP_FAILED)
+				{
+					throw std::bad_alloc();
+				}
+
+				char * const unaligned = static_cast<char *>(mapping);
+				const size_t leading_bytes = (region_size - (reinterpret_cast<size_t>(unaligned) % region_size)) % region_size;
+				region = unaligned + leading_bytes;
+
+				if (leading_bytes != 0)
+				{
+					munmap(unaligned, leading_bytes);
+				}
+
+				if (leading_bytes != region_size)
+				{
+					munmap(region + mapping_size, region_size - leading_bytes);
+				}
+
+				#ifdef MADV_HUGEPAGE
+					madvise(region, mapping_size, MADV_HUGEPAGE);
+				#endif
+			}
+
+			if (numa_node >= 0 && numa_node < 1024)
+			{
+				const size_t bits_per_word = sizeof(unsigned long) * 8;
+				unsigned long node_mask[1024 / (sizeof(unsigned long) * 8)] = {};
+				node_mask[static_cast<size_t>(numa_node) / bits_per_word] = 1UL << (static_cast<size_t>(numa_node) % bits_per_word);
+				syscall(SYS_mbind, region, mapping_size, 2 /* MPOL_BIND */, node_mask, 1024, 0); // Best effort - if binding fails, the default memory policy applies
+			}
+
+			return region;
+		#else
+			return static_cast<char *>(::operator new(mapping_size, std::align_val_t(region_size)));
+		#endif
+	}
+
+
+
+	void unmap_region(char * const region) noexcept
+	{
+		#ifdef __linux__
+			munmap(region, reinterpret_cast<region_header *>(region)->mapping_size);
+		#else
+			::operator delete(region, std::align_val_t(region_size));
+		#endif
+	}
+
+
+
+	char * new_region(const size_t mapping_size)
+	{
+		char * const region = map_region(mapping_size);
+		region_header * const header = reinterpret_cast<region_header *>(region);
+		header->live_allocations = 0;
+		header->mapping_size = mapping_size;
+		return region;
+	}
+
+
+
+public:
+
+	// region_size must be a power of two, and at least 4096. numa_node is the node to bind regions to, or -1 for no binding:
+	explicit colony_huge_page_arena(const size_t region_bytes = 2 * 1024 * 1024, const int node = -1) noexcept:
+		region_size(region_bytes),
+		numa_node(node),
+		current_region(NULL),
+		current_offset(0),
+		hugetlb_unavailable(false)
+	{
+		assert(region_size >= 4096 && (region_size & (region_size - 1)) == 0);
+	}
+
+
+
+	// All allocations must have been freed before destruction:
+	~colony_huge_page_arena() noexcept
+	{
+		release();
+	}
+
+
+
+	void * allocate(const size_t size, const size_t alignment)
+	{
+		assert(alignment <= region_size / 2);
+		const size_t offset_in_mapping = round_up(header_size, alignment);
+
+		if (size > region_size / 2) // Large allocation, ie. a group's memory block - give it its own mapping
+		{
+			if (size > std::numeric_limits<size_t>::max() - offset_in_mapping - region_size)
+			{
+				throw std::bad_alloc();
+			}
+
+			std::lock_guard<std::mutex> lock(arena_mutex);
+			char * const region = new_region(round_up(offset_in_mapping + size, region_size));
+			reinterpret_cast<region_header *>(region)->live_allocations = 1;
+			return static_cast<void *>(region + offset_in_mapping);
+		}
+
+		std::lock_guard<std::mutex> lock(arena_mutex);
+		size_t offset = round_up(current_offset, alignment);
+
+		if (current_region == NULL || offset + size > region_size)
+		{
+			char * const region = new_region(region_size);
+
+			if (current_region != NULL && reinterpret_cast<region_header *>(current_region)->live_allocations == 0)
+			{
+				unmap_region(current_region);
+			}
+
+			current_region = region;
+			offset = offset_in_mapping;
+		}
+
+		++(reinterpret_cast<region_header *>(current_region)->live_allocations);
+		current_offset = offset + size;
+		return static_cast<void *>(current_region + offset);
+	}
+
+
+
+	void deallocate(void * const block, const size_t size, const size_t alignment) noexcept
+	{
+		(void)size;
+		(void)alignment;
+		char * const region = static_cast<char *>(block) - (reinterpret_cast<size_t>(block) & (region_size - 1)); // Allocations always begin within the first region of their mapping
+		std::lock_guard<std::mutex> lock(arena_mutex);
+
+		if (--(reinterpret_cast<region_header *>(region)->live_allocations) == 0)
+		{
+			if (region == current_region) // Reuse the whole region
+			{
+				current_offset = header_size;
+			}
+			else
+			{
+				unmap_region(region);
+			}
+		}
+	}
+
+
+
+	// Unmaps the shared region, if it contains no live allocations:
+	void release() noexcept
+	{
+		std::lock_guard<std::mutex> lock(arena_mutex);
+
+		if (current_region != NULL && reinterpret_cast<region_header *>(current_region)->live_allocations == 0)
+		{
+			unmap_region(current_region);
+			current_region = NULL;
+		}
+	}
+
+
+
+	// The number of bytes available for an allocation (with alignment <= 64) that occupies exactly one region:
+	inline size_t block_bytes() const noexcept
+	{
+		return region_size - header_size;
+	}
+
+
+
+	inline size_t region_bytes() const noexcept
+	{
+		return region_size;
+	}
+
+
+
+	// The arena used by default-constructed colony_huge_page_allocators. It is intentionally never destroyed, so that colonies with static storage duration can still return memory to it during program exit:
+	static colony_huge_page_arena & shared_arena()
+	{
+		static colony_huge_page_arena * const arena = new colony_huge_page_arena();
+		return *arena;
+	}
+};
+
+
+
+// Allocates from a colony_huge_page_arena - the shared arena by default. eg. plf::colony<int, plf::colony_huge_page_allocator<int> > i_colony(plf::colony_limits(capacity, capacity), plf::colony_huge_page_allocator<int>(arena)), where capacity is plf::colony<int, plf::colony_huge_page_allocator<int> >::block_capacity_for_bytes(arena.block_bytes()):
+template <class element_type>
+class colony_huge_page_allocator
+{
+private:
+	colony_huge_page_arena *arena;
+
+	template <class other_type> friend class colony_huge_page_allocator;
+
+public:
+	typedef element_type value_type;
+
+	colony_huge_page_allocator() noexcept:
+		arena(&colony_huge_page_arena::shared_arena())
+	{}
+
+	explicit colony_huge_page_allocator(colony_huge_page_arena &source_arena) noexcept:
+		arena(&source_arena)
+	{}
+
+	template <class other_type>
+	colony_huge_page_allocator(const colony_huge_page_allocator<other_type> &source) noexcept:
+		arena(source.arena)
+	{}
+
+
+
+	element_type * allocate(const size_t number_of_elements)
+	{
+		if (number_of_elements > std::numeric_limits<size_t>::max() / sizeof(element_type))
+		{
+			throw std::bad_alloc();
+		}
+
+		return static_cast<element_type *>(arena->allocate(number_of_elements * sizeof(element_type), alignof(element_type)));
+	}
+
+
+
+	void deallocate(element_type * const location, const size_t number_of_elements) noexcept
+	{
+		arena->deallocate(static_cast<void *>(location), number_of_elements * sizeof(element_type), alignof(element_type));
+	}
+
+
+
+	template <class other_type>
+	inline bool operator == (const colony_huge_page_allocator<other_type> &rh) const noexcept
+	{
+		return arena == rh.arena;
+	}
+
+
+
+	template <class other_type>
+	inline bool operator != (const colony_huge_page_allocator<other_type> &rh) const noexcept
+	{
+		return arena != rh.arena;
+	}
+};
+
+}
+
+#endif
+
+#endif // PLF_COLONY_HUGE_PAGE_H
@@ -22,6 +22,7 @@
 #define PLF_HIVE_H
 
 #include <algorithm> // std::fill_n, std::sort, std::lexicographical_compare_three_way
+#include <bit> // std::countr_zero, std::countl_zero, std::popcount, for hive_priority::bitset
 #include <cassert>	// assert
 #include <cstring>	// memset, memcpy, size_t
 #include <limits>  // std::numeric_limits
@@ -31,6 +32,12 @@
 #include <functional> // std::less
 
 #include <cstddef> // offsetof, used in blank()
+
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L // ie. <algorithm> declares the execution-policy overloads, used by the parallel insert overloads
+	#define PLF_EXECUTION_POLICY_SUPPORT
+	#include <atomic> // std::atomic
+	#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
+#endif
 #include <type_traits> // std::is_trivially_destructible, enable_if_t, etc
 #include <utility> // std::move
 #include <initializer_list>
@@ -49,12 +56,18 @@ struct hive_limits // for use in block_capacity setting/getting functions and co
 };
 
 
-enum class hive_priority { performance, memory_use };
+enum class hive_priority { performance, memory_use, bitset };
+
+
+
+template <class element_type, class allocator_type, plf::hive_priority priority> class hive;
 
 
 
-template <class element_type, class allocator_type = std::allocator<element_type>, plf::hive_priority priority = plf::hive_priority::performance> class hive : private allocator_type // Empty base class optimisation (EBCO) - inheriting allocator functions
+// The occupancy representation of a hive's groups - ie. how elements are distinguished from erased locations - along with the iterators which scan it. hive derives from this and holds all container state, calling the marking functions below wherever elements are inserted or erased. This primary template is the jump-counting skipfield used by hive_priority::performance and hive_priority::memory_use, with a free list of erased locations stored in the erased elements' memory:
+template <class element_type, class allocator_type, plf::hive_priority priority> class hive_occupancy : public allocator_type // Empty base class optimisation (EBCO) - inheriting allocator functions
 {
+protected:
 	// Type-switching pattern:
 	template <bool flag, class is_true, class is_false> struct choose;
 
@@ -69,6 +82,7 @@ template <class element_type, class allocator_type = std::allocator<element_type
 	};
 
 	typedef typename choose<priority == plf::hive_priority::performance, unsigned short, unsigned char>::type		skipfield_type; // Note: unsigned short is equivalent to uint_least16_t ie. Using 16-bit unsigned integer in best-case scenario, greater-than-16-bit unsigned integer where platform doesn't support 16-bit types. unsigned char is always == 1 byte, as opposed to uint_8, which may not be
+	typedef skipfield_type			capacity_type; // The type of group capacities and sizes
 
 public:
 	// Standard container typedefs:
@@ -97,36 +111,40 @@ public:
 
 
 
-private:
+protected:
 
 	struct alignas(alignof(aligned_element_type)) aligned_allocation_struct
 	{
 	  char data[alignof(aligned_element_type)]; // Using char as sizeof is always guaranteed to be 1 byte regardless of the number of bits in a byte on given computer, whereas for example, uint8_t would fail on machines where there are more than 8 bits in a byte eg. Texas Instruments C54x DSPs.
 	};
 
-	#define PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group) ((((elements_per_group * (((sizeof(aligned_element_type) >= alignof(aligned_element_type)) ? sizeof(aligned_element_type) : alignof(aligned_element_type)) + sizeof(skipfield_type))) + sizeof(skipfield_type)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct)) // The size of a groups' memory block when expressed in multiples of the value_type's alignment. We also check to see if alignment is larger than sizeof value_type and use alignment size if so.
+
+	// The size of a groups' memory block when expressed in multiples of the value_type's alignment. We also check to see if alignment is larger than sizeof value_type and use alignment size if so:
+	static constexpr size_type aligned_block_size(const size_type elements_per_group) noexcept
+	{
+		return (((elements_per_group * (((sizeof(aligned_element_type) >= alignof(aligned_element_type)) ? sizeof(aligned_element_type) : alignof(aligned_element_type)) + sizeof(skipfield_type))) + sizeof(skipfield_type)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct);
+	}
 
 
 	// forward declarations for typedefs below
 	struct group;
-	struct item_index_tuple; // for use in sort()
 
 
 	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_element_type>		aligned_element_allocator_type;
 	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group>							group_allocator_type;
 	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<skipfield_type>				skipfield_allocator_type;
 	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_allocation_struct> aligned_struct_allocator_type;
-	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<item_index_tuple> 			tuple_allocator_type;
-	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<unsigned char> 				uchar_allocator_type;
 
 	typedef typename std::allocator_traits<aligned_element_allocator_type>::pointer	aligned_pointer_type; // pointer to the overaligned element type, not the original element type
 	typedef typename std::allocator_traits<group_allocator_type>::pointer				group_pointer_type;
 	typedef typename std::allocator_traits<skipfield_allocator_type>::pointer			skipfield_pointer_type;
 	typedef typename std::allocator_traits<aligned_struct_allocator_type>::pointer	aligned_struct_pointer_type;
-	typedef typename std::allocator_traits<tuple_allocator_type>::pointer				tuple_pointer_type;
+
+	static constexpr bool trivial_pointers = std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value; // ie. the hive's member pointers and iterators can be zeroed or copied with memset/memcpy
 
 
-	// Colony groups:
+
+	// Hive groups:
 	struct group : private aligned_struct_allocator_type	// ebco - inherit allocator functions
 	{
 		aligned_pointer_type 				last_endpoint; 			// The address which is one-past the highest cell number that's been used so far in this group - does not change via erasure but may change via insertion/emplacement/assignment (if no previously-erased locations are available to insert to). This variable is necessary because an iterator cannot access the hive's end_iterator. It is probably the most-used variable in general hive usage (being heavily used in operator ++, --), so is first in struct. If all cells in the group have been inserted into at some point, it will be == reinterpret_cast<aligned_pointer_type>(skipfield).
@@ -143,9 +161,9 @@ private:
 
 		// Group elements allocation explanation: memory has to be allocated as an aligned type in order to align with memory boundaries correctly (as opposed to being allocated as char or uint_8). Unfortunately this makes combining the element memory block and the skipfield memory block into one allocation (which increases performance) a little more tricky. Specifically it means in many cases the allocation will amass more memory than is needed, particularly if the element type is large.
 
-		group(const skipfield_type elements_per_group, group_pointer_type const previous):
+		group(const skipfield_type elements_per_group, group_pointer_type const previous, const size_type group_num):
 			last_endpoint(reinterpret_cast<aligned_pointer_type>(
-			std::allocator_traits<aligned_struct_allocator_type>::allocate(*this, PLF_GROUP_ALIGNED_BLOCK_SIZE(elements_per_group), (previous == NULL) ? 0 : previous->elements))), /* Because this variable occurs first in the struct, we allocate here initially, then increment its value in the element initialisation below. As opposed to doing a secondary assignment in the code */
+			std::allocator_traits<aligned_struct_allocator_type>::allocate(*this, aligned_block_size(elements_per_group), (previous == NULL) ? 0 : previous->elements))), /* Because this variable occurs first in the struct, we allocate here initially, then increment its value in the element initialisation below. As opposed to doing a secondary assignment in the code */
 			next_group(NULL),
 			elements(last_endpoint++),
 			skipfield(reinterpret_cast<skipfield_pointer_type>(elements + elements_per_group)),
@@ -154,7 +172,7 @@ private:
 			capacity(elements_per_group),
 			size(1),
 			erasures_list_next_group(NULL),
-			group_number((previous == NULL) ? 0 : previous->group_number + 1u)
+			group_number(group_num)
 		{
 			// Static casts to unsigned int from short not necessary as C++ automatically promotes lesser types for arithmetic purposes.
 			std::memset(&*skipfield, 0, sizeof(skipfield_type) * (static_cast<size_type>(elements_per_group) + 1u)); // &* to avoid problems with non-trivial pointers
@@ -176,10 +194,31 @@ private:
 
 
 
+		inline bool has_erasures() const noexcept // ie. the group is in the groups-with-erasures list
+		{
+			return free_list_head != std::numeric_limits<skipfield_type>::max();
+		}
+
+
+
+		inline aligned_pointer_type end_of_elements() const noexcept
+		{
+			return reinterpret_cast<aligned_pointer_type>(skipfield);
+		}
+
+
+
+		inline void copy_erasure_state(const group &source) noexcept // For groups whose memory block has been copied from the source's
+		{
+			free_list_head = source.free_list_head;
+		}
+
+
+
 		~group() noexcept
 		{
 			// Null check not necessary (for copied group as above) as deallocate will also perform a null check.
-			std::allocator_traits<aligned_struct_allocator_type>::deallocate(*this, reinterpret_cast<aligned_struct_pointer_type>(elements), PLF_GROUP_ALIGNED_BLOCK_SIZE(capacity));
+			std::allocator_traits<aligned_struct_allocator_type>::deallocate(*this, reinterpret_cast<aligned_struct_pointer_type>(elements), aligned_block_size(capacity));
 		}
 	};
 
@@ -198,12 +237,13 @@ public:
 
 	public:
 		typedef std::bidirectional_iterator_tag	iterator_category;
-		typedef typename hive::value_type 		value_type;
-		typedef typename hive::difference_type	difference_type;
-		typedef typename choose<is_const, typename hive::const_pointer, typename hive::pointer>::type		pointer;
-		typedef typename choose<is_const, typename hive::const_reference, typename hive::reference>::type reference;
+		typedef typename hive_occupancy::value_type 		value_type;
+		typedef typename hive_occupancy::difference_type	difference_type;
+		typedef typename choose<is_const, typename hive_occupancy::const_pointer, typename hive_occupancy::pointer>::type		pointer;
+		typedef typename choose<is_const, typename hive_occupancy::const_reference, typename hive_occupancy::reference>::type reference;
 
-		friend class hive;
+		friend class hive_occupancy;
+		friend class plf::hive<element_type, allocator_type, priority>;
 		friend class hive_reverse_iterator<false>;
 		friend class hive_reverse_iterator<true>;
 
@@ -341,7 +381,7 @@ public:
 			group_pointer = group_pointer->previous_group;
 			const skipfield_pointer_type skipfield = group_pointer->skipfield + group_pointer->capacity - 1;
 			const skipfield_type skip = *skipfield;
-			element_pointer = (reinterpret_cast<hive::aligned_pointer_type>(group_pointer->skipfield) - 1) - skip;
+			element_pointer = (reinterpret_cast<hive_occupancy::aligned_pointer_type>(group_pointer->skipfield) - 1) - skip;
 			skipfield_pointer = skipfield - skip;
 			return *this;
 		}
@@ -405,6 +445,9 @@ public:
 		// Used by cend(), erase() etc:
 		hive_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p, const skipfield_pointer_type skipfield_p) noexcept: group_pointer(group_p), element_pointer(element_p), skipfield_pointer(skipfield_p) {}
 
+		// Used where the skipfield location is not already known:
+		hive_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p) noexcept: group_pointer(group_p), element_pointer(element_p), skipfield_pointer(group_p->skipfield + (element_p - group_p->elements)) {}
+
 
 	public:
 
@@ -475,7 +518,7 @@ public:
 				{
 					const difference_type distance_from_end = static_cast<difference_type>(group_pointer->last_endpoint - element_pointer);
 
-					if (group_pointer->size == static_cast<skipfield_type>(distance_from_end)) // ie. if there are no erasures in the group (using endpoint - elements_start to determine number of elements in group just in case this is the last group of the hive, in which case group->last_endpoint != group->elements + group->capacity)
+					if (group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. if there are no erasures in the group. Note: comparing size against distance_from_end is insufficient here, as erasures before and after the iterator can cancel out
 					{
 						if (distance < distance_from_end)
 						{
@@ -661,13 +704,13 @@ public:
 				}
 				else if (group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. no erased elements in this group
 				{
-					element_pointer = reinterpret_cast<aligned_pointer_type>(group_pointer->skipfield) - distance;
-					skipfield_pointer = (group_pointer->skipfield + group_pointer->capacity) - distance;
+					element_pointer = group_pointer->last_endpoint - distance; // last_endpoint rather than the end of the group's capacity, as iterator may have been end() in a partially-filled back group
+					skipfield_pointer = (group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements)) - distance;
 					return;
 				}
 				else // ie. no more groups to traverse but there are erased elements in this group
 				{
-					skipfield_pointer = group_pointer->skipfield + group_pointer->capacity;
+					skipfield_pointer = group_pointer->skipfield + (group_pointer->last_endpoint - group_pointer->elements);
 
 					do
 					{
@@ -746,7 +789,7 @@ public:
 					iterator1.group_pointer = iterator1.group_pointer->next_group;
 				}
 
-				iterator1.skipfield_pointer = iterator1.group_pointer->skipfield;
+				iterator1.skipfield_pointer = iterator1.group_pointer->skipfield + *(iterator1.group_pointer->skipfield); // ie. first non-erased element in group
 			}
 
 
@@ -754,9 +797,9 @@ public:
 			{
 				distance += iterator2.skipfield_pointer - iterator1.skipfield_pointer;
 			}
-			else if (iterator2.group_pointer->last_endpoint - 1 >= iterator2.element_pointer || iterator2.element_pointer + *(iterator2.skipfield_pointer + 1) == iterator2.group_pointer->last_endpoint) // ie. if iterator2 is .end() or the last element in the block
+			else if (iterator2.element_pointer == iterator2.group_pointer->last_endpoint && iterator1.skipfield_pointer == iterator1.group_pointer->skipfield + *(iterator1.group_pointer->skipfield)) // ie. if the range covers the whole group
 			{
-				distance += static_cast<difference_type>(iterator2.group_pointer->size) - (iterator2.group_pointer->last_endpoint - iterator2.element_pointer);
+				distance += static_cast<difference_type>(iterator2.group_pointer->size);
 			}
 			else
 			{
@@ -824,12 +867,13 @@ public:
 
 	public:
 		typedef std::bidirectional_iterator_tag	iterator_category;
-		typedef typename hive::value_type 		value_type;
-		typedef typename hive::difference_type	difference_type;
-		typedef typename choose<r_is_const, typename hive::const_pointer, typename hive::pointer>::type		pointer;
-		typedef typename choose<r_is_const, typename hive::const_reference, typename hive::reference>::type	reference;
+		typedef typename hive_occupancy::value_type 		value_type;
+		typedef typename hive_occupancy::difference_type	difference_type;
+		typedef typename choose<r_is_const, typename hive_occupancy::const_pointer, typename hive_occupancy::pointer>::type		pointer;
+		typedef typename choose<r_is_const, typename hive_occupancy::const_reference, typename hive_occupancy::reference>::type	reference;
 
-		friend class hive;
+		friend class hive_occupancy;
+		friend class plf::hive<element_type, allocator_type, priority>;
 
 
 		inline hive_reverse_iterator& operator = (const hive_reverse_iterator &source) noexcept
@@ -919,9 +963,9 @@ public:
 		// In this case we have to redefine the algorithm, rather than using the internal iterator's -- operator, in order for the reverse_iterator to be allowed to reach rend() ie. begin_iterator - 1
 		hive_reverse_iterator & operator ++ ()
 		{
-			hive::group_pointer_type &group_pointer = it.group_pointer;
-			hive::aligned_pointer_type &element_pointer = it.element_pointer;
-			hive::skipfield_pointer_type &skipfield_pointer = it.skipfield_pointer;
+			hive_occupancy::group_pointer_type &group_pointer = it.group_pointer;
+			hive_occupancy::aligned_pointer_type &element_pointer = it.element_pointer;
+			hive_occupancy::skipfield_pointer_type &skipfield_pointer = it.skipfield_pointer;
 
 			assert(group_pointer != NULL);
 
@@ -930,7 +974,7 @@ public:
 				element_pointer -= static_cast<size_type>(*(--skipfield_pointer)) + 1u;
 				skipfield_pointer -= *skipfield_pointer;
 
-				if (!(element_pointer == group_pointer->elements - 1 && group_pointer->previous_group == NULL)) // ie. iterator is not == rend()
+				if (element_pointer != group_pointer->elements - 1) // ie. skipfield did not take us to the start of the group (with some preceding consecutive erased elements)
 				{
 					return *this;
 				}
@@ -940,13 +984,13 @@ public:
 			{
 				group_pointer = group_pointer->previous_group;
 				skipfield_pointer = group_pointer->skipfield + group_pointer->capacity - 1;
-				element_pointer = (reinterpret_cast<hive::aligned_pointer_type>(group_pointer->skipfield) - 1) - *skipfield_pointer;
+				element_pointer = (reinterpret_cast<hive_occupancy::aligned_pointer_type>(group_pointer->skipfield) - 1) - *skipfield_pointer;
 				skipfield_pointer -= *skipfield_pointer;
 			}
 			else // necessary so that reverse_iterator can end up == rend(), if we were already at first element in hive
 			{
-				--element_pointer;
-				--skipfield_pointer;
+				element_pointer = group_pointer->elements - 1;
+				skipfield_pointer = group_pointer->skipfield - 1;
 			}
 
 			return *this;
@@ -980,9 +1024,9 @@ public:
 
 
 
-		inline typename hive::iterator base() const
+		inline typename hive_occupancy::iterator base() const
 		{
-			return ++(typename hive::iterator(it));
+			return ++(typename hive_occupancy::iterator(it));
 		}
 
 
@@ -1054,7 +1098,7 @@ public:
 
 	private:
 		// Used by rend(), etc:
-		hive_reverse_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p, const skipfield_pointer_type skipfield_p) noexcept: it(group_p, element_p, skipfield_p) {}
+		hive_reverse_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p) noexcept: it(group_p, element_p) {}
 
 
 
@@ -1345,265 +1389,2154 @@ public:
 
 
 
-private:
-
-	// Colony Member variables:
-
-	iterator 				end_iterator, begin_iterator;
-	group_pointer_type	groups_with_erasures_list_head,	// Head of the singly-linked list of groups which have erased-element memory locations available for re-use
-								unused_groups_head;					// Head of singly-linked list of groups retained by erase()/clear() or created by reserve()
-	size_type				total_size, total_capacity;
-
-	struct ebco_pair2 : tuple_allocator_type // Packaging the element pointer allocator with a lesser-used member variable, for empty-base-class optimisation
-	{
-		skipfield_type min_group_capacity;
-		explicit ebco_pair2(const skipfield_type min_elements) noexcept: min_group_capacity(min_elements) {}
-	}							tuple_allocator_pair;
-
-	struct ebco_pair : group_allocator_type
-	{
-		skipfield_type max_group_capacity;
-		explicit ebco_pair(const skipfield_type max_elements) noexcept: max_group_capacity(max_elements) {}
-	}							group_allocator_pair;
-
+protected:
 
+	explicit hive_occupancy(const allocator_type &alloc) noexcept:
+		allocator_type(alloc)
+	{}
 
-	// An adaptive minimum based around sizeof(element_type), sizeof(group) and sizeof(hive):
-	#define PLF_MIN_BLOCK_CAPACITY (sizeof(aligned_element_type) * 8 > (sizeof(plf::hive<element_type>) + sizeof(group)) * 2) ? 8 : (((sizeof(plf::hive<element_type>) + sizeof(group)) * 2) / sizeof(aligned_element_type))
 
 
+	// Occupancy marking functions, called by hive wherever elements are inserted or erased. These update group sizes, but the remaining container state (total size, the groups-with-erasures list, begin and end iterators) is left to the caller:
 
-	inline void check_capacities_conformance(plf::hive_limits capacities) const
+	static inline iterator group_begin(const group_pointer_type the_group) noexcept // The first element in a non-empty group
 	{
-		if (capacities.min < 2 || capacities.min > capacities.max || capacities.max > std::numeric_limits<skipfield_type>::max())
-		{
-			throw std::length_error("Supplied memory block capacities outside of allowable ranges");
-		}
+		return iterator(the_group, the_group->elements + *(the_group->skipfield), the_group->skipfield + *(the_group->skipfield));
 	}
 
 
 
-public:
-
-	// Default constructor:
-
-	hive():
-		allocator_type(allocator_type()),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
-		group_allocator_pair(std::numeric_limits<skipfield_type>::max())
-	{}
+	static inline iterator group_end(const group_pointer_type the_group) noexcept // One-past the last element location used so far in the group - end() if this is the back group
+	{
+		return iterator(the_group, the_group->last_endpoint, the_group->skipfield + (the_group->last_endpoint - the_group->elements));
+	}
 
 
 
-	explicit hive(const plf::hive_limits capacities):
-		allocator_type(allocator_type()),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+	static inline bool is_element(const group_pointer_type the_group, const aligned_pointer_type location) noexcept
 	{
-		check_capacities_conformance(capacities);
+		return *(the_group->skipfield + (location - the_group->elements)) == 0;
 	}
 
 
 
-	// Default constructor (allocator-extended):
-
-	explicit hive(const allocator_type &alloc):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
-		group_allocator_pair(std::numeric_limits<skipfield_type>::max())
-	{}
+	// Marks the back group location end points to as holding a newly-constructed element, and moves end past it:
+	static inline void mark_appended(iterator &end) noexcept
+	{
+		end.group_pointer->last_endpoint = ++end.element_pointer;
+		++end.skipfield_pointer;
+		++(end.group_pointer->size);
+	}
 
 
 
-	explicit hive(const plf::hive_limits capacities, const allocator_type &alloc):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+	// As above, for the elements constructed in the back group between its last_endpoint and end, which has already been moved past them:
+	static inline void mark_filled(iterator &end) noexcept
 	{
-		check_capacities_conformance(capacities);
+		const group_pointer_type the_group = end.group_pointer;
+		the_group->size = static_cast<skipfield_type>(the_group->size + (end.element_pointer - the_group->last_endpoint));
+		the_group->last_endpoint = end.element_pointer;
+		end.skipfield_pointer = the_group->skipfield + (end.element_pointer - the_group->elements);
 	}
 
 
 
-	// Copy constructor:
-
-	hive(const hive &source):
-		allocator_type(source),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size))), // min group size is set to value closest to total number of elements in source hive in order to not create unnecessary small groups in the range-insert below, then reverts to the original min group size afterwards. This effectively saves a call to reserve.
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
-	{ // can skip checking for skipfield conformance here as the skipfields must be equal between the destination and source, and source will have already had theirs checked. Same applies for other copy and move constructors below
-		range_assign(source.begin_iterator, source.total_size);
-		tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity; // reset to correct value for future operations
+	// For catch blocks in construct_in_erased_location() - a throwing constructor may already have overwritten the free list node stored in the reused element's memory:
+	static void restore_free_list_node(aligned_pointer_type const location, const skipfield_type prev_free_list_index) noexcept
+	{
+		*(reinterpret_cast<skipfield_pointer_type>(location)) = prev_free_list_index;
+		*(reinterpret_cast<skipfield_pointer_type>(location) + 1) = std::numeric_limits<skipfield_type>::max();
 	}
 
 
 
-	// Copy constructor (allocator-extended):
-
-	hive(const hive &source, const allocator_type &alloc):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size))),
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	static void update_skipblock(const iterator &new_location, const skipfield_type prev_free_list_index) noexcept
 	{
-		range_assign(source.begin_iterator, source.total_size);
-		tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity;
-	}
+		const group_pointer_type the_group = new_location.group_pointer;
+		const skipfield_type new_value = static_cast<skipfield_type>(*(new_location.skipfield_pointer) - 1);
 
+		if (new_value != 0) // ie. skipfield was not 1, ie. a single-node skipblock, with no additional nodes to update
+		{
+			// set (new) start and (original) end of skipblock to new value:
+			*(new_location.skipfield_pointer + new_value) = *(new_location.skipfield_pointer + 1) = new_value;
 
+			// transfer free list node to new start node:
+			++(the_group->free_list_head);
 
-private:
+			if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the tail free list node
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_free_list_index) + 1) = the_group->free_list_head;
+			}
 
-	inline void blank() noexcept
-	{
-		if constexpr (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value)	// if all pointer types are trivial, we can just nuke it from orbit with memset (NULL is always 0 in C++):
-		{
-			std::memset(static_cast<void *>(this), 0, offsetof(hive, tuple_allocator_pair));
+			*(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer + 1)) = prev_free_list_index;
+			*(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer + 1) + 1) = std::numeric_limits<skipfield_type>::max();
 		}
 		else
 		{
-			end_iterator.group_pointer = NULL;
-			end_iterator.element_pointer = NULL;
-			end_iterator.skipfield_pointer = NULL;
-			begin_iterator.group_pointer = NULL;
-			begin_iterator.element_pointer = NULL;
-			begin_iterator.skipfield_pointer = NULL;
-			groups_with_erasures_list_head = NULL;
-			unused_groups_head = NULL;
-			total_size = 0;
-			total_capacity = 0;
+			the_group->free_list_head = prev_free_list_index; // If this is now the maximum value, the group has no erasures left
+
+			if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the last free list node
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_free_list_index) + 1) = std::numeric_limits<skipfield_type>::max();
+			}
 		}
+
+		*(new_location.skipfield_pointer) = 0;
+		++(the_group->size);
 	}
 
-public:
 
 
+	// Constructs an element in the group's most recently erased location. The group must have erasures:
+	template <typename... arguments>
+	iterator construct_in_erased_location(const group_pointer_type the_group, arguments &&... parameters)
+	{
+		const iterator new_location(the_group, the_group->elements + the_group->free_list_head, the_group->skipfield + the_group->free_list_head);
 
-	// Move constructor:
+		// We always reuse the element at the start of the skipblock, this is also where the free-list information for that skipblock is stored. Get the previous free-list node's index from this memory space, before we write to our element to it. 'Next' index is always the free_list_head (as represented by the maximum value of the skipfield type) here so we don't need to get it:
+		const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer));
 
-	hive(hive &&source) noexcept:
-		allocator_type(source),
-		end_iterator(std::move(source.end_iterator)),
-		begin_iterator(std::move(source.begin_iterator)),
-		groups_with_erasures_list_head(std::move(source.groups_with_erasures_list_head)),
-		unused_groups_head(std::move(source.unused_groups_head)),
-		total_size(source.total_size),
-		total_capacity(source.total_capacity),
-		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
-	{
-		assert(&source != this);
-		source.blank();
-	}
+		try
+		{
+			std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(new_location.element_pointer), std::forward<arguments>(parameters) ...);
+		}
+		catch (...)
+		{
+			restore_free_list_node(new_location.element_pointer, prev_free_list_index);
+			throw;
+		}
 
+		update_skipblock(new_location, prev_free_list_index);
+		return new_location;
+	}
 
 
-	// Move constructor (allocator-extended):
 
-	hive(hive &&source, const allocator_type &alloc):
-		allocator_type(alloc),
-		end_iterator(std::move(source.end_iterator)),
-		begin_iterator(std::move(source.begin_iterator)),
-		groups_with_erasures_list_head(std::move(source.groups_with_erasures_list_head)),
-		unused_groups_head(std::move(source.unused_groups_head)),
-		total_size(source.total_size),
-		total_capacity(source.total_capacity),
-		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
-		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	// For catch blocks in range_fill_skipblock and fill_skipblock
+	static void recover_from_partial_skipblock_fill(const group_pointer_type the_group, aligned_pointer_type const location, const aligned_pointer_type current_location, skipfield_pointer_type const skipfield_pointer, const skipfield_type prev_free_list_node) noexcept
 	{
-		assert(&source != this);
-		source.blank();
-	}
+		if constexpr (!std::is_nothrow_copy_constructible<element_type>::value)
+		{
+			// Reconstruct existing skipblock and free-list indexes to reflect partially-reused skipblock:
+			const skipfield_type elements_constructed_before_exception = static_cast<skipfield_type>(current_location - location);
+			const skipfield_type new_skipblock_size = static_cast<skipfield_type>(*skipfield_pointer - elements_constructed_before_exception); // skipblock head node is not zeroed until the fill completes
+			the_group->size = static_cast<skipfield_type>(the_group->size + elements_constructed_before_exception);
 
+			std::memset(skipfield_pointer, 0, elements_constructed_before_exception * sizeof(skipfield_type));
+			*(skipfield_pointer + elements_constructed_before_exception) = new_skipblock_size;
+			*(skipfield_pointer + elements_constructed_before_exception + new_skipblock_size - 1) = new_skipblock_size;
 
+			*(reinterpret_cast<skipfield_pointer_type>(location + elements_constructed_before_exception)) = prev_free_list_node;
+			*(reinterpret_cast<skipfield_pointer_type>(location + elements_constructed_before_exception) + 1) = std::numeric_limits<skipfield_type>::max();
 
-	// Fill constructor:
+			const skipfield_type new_skipblock_head_index = static_cast<skipfield_type>((location - the_group->elements) + elements_constructed_before_exception);
+			the_group->free_list_head = new_skipblock_head_index;
 
-	hive(const size_type fill_number, const element_type &element, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<skipfield_type>::max()), const allocator_type &alloc = allocator_type()):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
-	{
-		check_capacities_conformance(capacities);
-		assign(fill_number, element);
+			if (prev_free_list_node != std::numeric_limits<skipfield_type>::max())
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_free_list_node) + 1) = new_skipblock_head_index;
+			}
+		}
 	}
 
 
 
-	// Default-value fill constructor:
-
-	explicit hive(const size_type fill_number, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<skipfield_type>::max()), const allocator_type &alloc = allocator_type()):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+	void fill_skipblock(const group_pointer_type the_group, const element_type &element, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
 	{
-		check_capacities_conformance(capacities);
-		assign(fill_number, element_type());
-	}
-
+		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
+		{
+			if constexpr (std::is_trivially_copyable<element_type>::value && std::is_trivially_copy_constructible<element_type>::value)
+			{
+				if constexpr (sizeof(aligned_element_type) != sizeof(element_type))
+				{
+					alignas (alignof(aligned_element_type)) element_type aligned_copy = element;
+					std::fill_n(location, size, *(reinterpret_cast<aligned_pointer_type>(&aligned_copy)));
+				}
+				else
+				{
+					std::fill_n(reinterpret_cast<pointer>(location), size, element);
+				}
+			}
+			else
+			{
+				const aligned_pointer_type fill_end = location + size;
 
+				for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
+				{
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), element);
+				}
+			}
+		}
+		else
+		{
+			const aligned_pointer_type fill_end = location + size;
+			const skipfield_type prev_free_list_node = *(reinterpret_cast<skipfield_pointer_type>(location)); // in case of exception, grabbing indexes before free_list node is reused
 
-	// Range constructor:
+			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
+			{
+				try
+				{
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), element);
+				}
+				catch (...)
+				{
+					recover_from_partial_skipblock_fill(the_group, location, current_location, skipfield_pointer, prev_free_list_node);
+					throw;
+				}
+			}
+		}
 
-	template<typename iterator_type>
-	hive(const typename std::enable_if_t<!std::numeric_limits<iterator_type>::is_integer, iterator_type> &first, const iterator_type &last, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<skipfield_type>::max()), const allocator_type &alloc = allocator_type()):
-		allocator_type(alloc),
-		groups_with_erasures_list_head(NULL),
-		unused_groups_head(NULL),
-		total_size(0),
-		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
-	{
-		check_capacities_conformance(capacities);
-		assign<iterator_type>(first, last);
+		std::memset(skipfield_pointer, 0, size * sizeof(skipfield_type)); // reset skipfield nodes within skipblock to 0
+		the_group->size = static_cast<skipfield_type>(the_group->size + size);
 	}
 
 
 
-	// Range constructor - sentinel support:
-
-	template <class iterator_type, class sentinel>
+	template <class iterator_type>
+	iterator_type range_fill_skipblock(const group_pointer_type the_group, iterator_type it, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
+	{
+		const aligned_pointer_type fill_end = location + size;
+
+		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
+		{
+			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
+			{
+				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), *it++);
+			}
+		}
+		else
+		{
+			const skipfield_type prev_free_list_node = *(reinterpret_cast<skipfield_pointer_type>(location)); // in case of exception, grabbing indexes before free_list node is reused
+
+			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
+			{
+				try
+				{
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), *it++);
+				}
+				catch (...)
+				{
+					recover_from_partial_skipblock_fill(the_group, location, current_location, skipfield_pointer, prev_free_list_node);
+					throw;
+				}
+			}
+		}
+
+		std::memset(skipfield_pointer, 0, size * sizeof(skipfield_type)); // reset skipfield nodes within skipblock to 0
+		the_group->size = static_cast<skipfield_type>(the_group->size + size);
+		return it;
+	}
+
+
+
+	// Constructs copies of element in up to size of the group's erased locations, most recently erased skipblock first, until either size or the group's erasures are exhausted. If a construction throws, the group is left consistent with the elements constructed so far:
+	void fill_erased_locations(const group_pointer_type the_group, size_type size, const element_type &element)
+	{
+		do
+		{
+			aligned_pointer_type const element_pointer = the_group->elements + the_group->free_list_head;
+			skipfield_pointer_type const skipfield_pointer = the_group->skipfield + the_group->free_list_head;
+			const skipfield_type skipblock_size = *skipfield_pointer;
+
+			if (skipblock_size <= size)
+			{
+				the_group->free_list_head = *(reinterpret_cast<skipfield_pointer_type>(element_pointer)); // set free list head to previous free list node
+				fill_skipblock(the_group, element, element_pointer, skipfield_pointer, skipblock_size);
+				size -= skipblock_size;
+
+				if (the_group->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. there are more skipblocks to be filled in this group
+				{
+					*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + the_group->free_list_head) + 1) = std::numeric_limits<skipfield_type>::max(); // set 'next' index of new free list head to 'end' (numeric max)
+				}
+			}
+			else // skipblock is larger than remaining number of elements
+			{
+				const skipfield_type prev_index = *(reinterpret_cast<skipfield_pointer_type>(element_pointer)); // save before element location is overwritten
+				fill_skipblock(the_group, element, element_pointer, skipfield_pointer, static_cast<skipfield_type>(size));
+				const skipfield_type new_skipblock_size = static_cast<skipfield_type>(skipblock_size - size);
+
+				// Update skipfield (earlier nodes already memset'd in fill_skipblock function):
+				*(skipfield_pointer + size) = new_skipblock_size;
+				*(skipfield_pointer + skipblock_size - 1) = new_skipblock_size;
+				the_group->free_list_head = static_cast<skipfield_type>(the_group->free_list_head + size); // set free list head to new start node
+
+				// Update free list with new head:
+				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size)) = prev_index;
+				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size) + 1) = std::numeric_limits<skipfield_type>::max();
+
+				if (prev_index != std::numeric_limits<skipfield_type>::max())
+				{
+					*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_index) + 1) = the_group->free_list_head; // set 'next' index of previous skipblock to new start of skipblock
+				}
+
+				return;
+			}
+		} while (size != 0 && the_group->free_list_head != std::numeric_limits<skipfield_type>::max());
+	}
+
+
+
+	// As above, constructing from it onwards. Returns it incremented past the elements constructed:
+	template <class iterator_type>
+	iterator_type range_fill_erased_locations(const group_pointer_type the_group, size_type size, iterator_type it)
+	{
+		do
+		{
+			aligned_pointer_type const element_pointer = the_group->elements + the_group->free_list_head;
+			skipfield_pointer_type const skipfield_pointer = the_group->skipfield + the_group->free_list_head;
+			const skipfield_type skipblock_size = *skipfield_pointer;
+
+			if (skipblock_size <= size)
+			{
+				the_group->free_list_head = *(reinterpret_cast<skipfield_pointer_type>(element_pointer));
+				it = range_fill_skipblock(the_group, it, element_pointer, skipfield_pointer, skipblock_size);
+				size -= skipblock_size;
+
+				if (the_group->free_list_head != std::numeric_limits<skipfield_type>::max())
+				{
+					*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + the_group->free_list_head) + 1) = std::numeric_limits<skipfield_type>::max();
+				}
+			}
+			else
+			{
+				const skipfield_type prev_index = *(reinterpret_cast<skipfield_pointer_type>(element_pointer));
+				it = range_fill_skipblock(the_group, it, element_pointer, skipfield_pointer, static_cast<skipfield_type>(size));
+				const skipfield_type new_skipblock_size = static_cast<skipfield_type>(skipblock_size - size);
+
+				*(skipfield_pointer + size) = new_skipblock_size;
+				*(skipfield_pointer + skipblock_size - 1) = new_skipblock_size;
+				the_group->free_list_head = static_cast<skipfield_type>(the_group->free_list_head + size);
+
+				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size)) = prev_index;
+				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size) + 1) = std::numeric_limits<skipfield_type>::max();
+
+				if (prev_index != std::numeric_limits<skipfield_type>::max())
+				{
+					*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_index) + 1) = the_group->free_list_head;
+				}
+
+				return it;
+			}
+		} while (size != 0 && the_group->free_list_head != std::numeric_limits<skipfield_type>::max());
+
+		return it;
+	}
+
+
+
+	// Marks the location of an element which has been destroyed as erased, and adds it to the group's free list. The group must have other elements remaining. Returns the next element, or end():
+	static iterator mark_erased(const const_iterator &it) noexcept
+	{
+		// Code logic for following section:
+		// ---------------------------------
+		// If current skipfield node has no skipblock on either side, create new skipblock of size 1
+		// If node only has skipblock on left, set current node and start node of the skipblock to left node value + 1.
+		// If node only has skipblock on right, make this node the start node of the skipblock and update end node
+		// If node has skipblocks on left and right, set start node of left skipblock and end node of right skipblock to the values of the left + right nodes + 1
+
+		// Optimization explanation:
+		// The contextual logic below is the same as that in the insert() functions but in this case the value of the current skipfield node will always be
+		// zero (since it is not yet erased), meaning no additional manipulations are necessary for the previous skipfield node comparison - we only have to check against zero
+		const char prev_skipfield = *(it.skipfield_pointer - (it.skipfield_pointer != it.group_pointer->skipfield)) != 0;
+		const char after_skipfield = *(it.skipfield_pointer + 1) != 0;  // NOTE: boundary test (checking against end-of-elements) is able to be skipped due to the extra skipfield node (compared to element field) - which is present to enable faster iterator operator ++ operations
+		skipfield_type update_value = 1;
+
+		if (!(prev_skipfield | after_skipfield)) // no consecutive erased elements
+		{
+			*it.skipfield_pointer = 1; // solo skipped node
+			const skipfield_type index = static_cast<skipfield_type>(it.element_pointer - it.group_pointer->elements);
+
+			if (it.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + it.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
+			}
+
+			*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer)) = it.group_pointer->free_list_head;
+			*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
+			it.group_pointer->free_list_head = index;
+		}
+		else if (prev_skipfield & (!after_skipfield)) // previous erased consecutive elements, none following
+		{
+			*(it.skipfield_pointer - *(it.skipfield_pointer - 1)) = *it.skipfield_pointer = static_cast<skipfield_type>(*(it.skipfield_pointer - 1) + 1);
+		}
+		else if ((!prev_skipfield) & after_skipfield) // following erased consecutive elements, none preceding
+		{
+			const skipfield_type following_value = static_cast<skipfield_type>(*(it.skipfield_pointer + 1) + 1);
+			*(it.skipfield_pointer + following_value - 1) = *(it.skipfield_pointer) = following_value;
+
+			const skipfield_type following_previous = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1));
+			const skipfield_type following_next = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1) + 1);
+			*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer)) = following_previous;
+			*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer) + 1) = following_next;
+
+			const skipfield_type index = static_cast<skipfield_type>(it.element_pointer - it.group_pointer->elements);
+
+			if (following_previous != std::numeric_limits<skipfield_type>::max())
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_previous) + 1) = index; // Set next index of previous free list node to this node's 'next' index
+			}
+
+			if (following_next != std::numeric_limits<skipfield_type>::max())
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_next)) = index;	// Set previous index of next free list node to this node's 'previous' index
+			}
+			else
+			{
+				it.group_pointer->free_list_head = index;
+			}
+
+			update_value = following_value;
+		}
+		else // both preceding and following consecutive erased elements - erased element is between two skipblocks
+		{
+			const skipfield_type preceding_value = *(it.skipfield_pointer - 1);
+			const skipfield_type following_value = static_cast<skipfield_type>(*(it.skipfield_pointer + 1) + 1);
+
+			// Join the skipblocks
+			*(it.skipfield_pointer - preceding_value) = *(it.skipfield_pointer + following_value - 1) = static_cast<skipfield_type>(preceding_value + following_value);
+
+			// Remove the following skipblock's entry from the free list
+			const skipfield_type following_previous = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1));
+			const skipfield_type following_next = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1) + 1);
+
+			if (following_previous != std::numeric_limits<skipfield_type>::max())
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_previous) + 1) = following_next; // Set next index of previous free list node to this node's 'next' index
+			}
+
+			if (following_next != std::numeric_limits<skipfield_type>::max())
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_next)) = following_previous; // Set previous index of next free list node to this node's 'previous' index
+			}
+			else
+			{
+				it.group_pointer->free_list_head = following_previous;
+			}
+
+			update_value = following_value;
+		}
+
+		iterator return_iterator(it.group_pointer, it.element_pointer + update_value, it.skipfield_pointer + update_value);
+
+		if (return_iterator.element_pointer == it.group_pointer->last_endpoint && it.group_pointer->next_group != NULL)
+		{
+			return_iterator = group_begin(it.group_pointer->next_group);
+		}
+
+		return return_iterator;
+	}
+
+
+
+	// Destroys the elements in [first, last) within first's group and marks their locations as erased, without updating the group's size. Returns the number of elements erased:
+	size_type erase_in_group(const_iterator current, const aligned_pointer_type last) noexcept
+	{
+		const const_iterator first = current;
+		const group_pointer_type the_group = first.group_pointer;
+		size_type number_of_group_erasures = 0;
+
+		// Schema: first erase all non-erased elements until last & remove all skipblocks in the range from the free_list. Then, either update preceding skipblock or create new one:
+		if (std::is_trivially_destructible<element_type>::value && the_group->free_list_head == std::numeric_limits<skipfield_type>::max())
+		{
+			number_of_group_erasures += static_cast<size_type>(last - current.element_pointer);
+		}
+		else
+		{
+			while (current.element_pointer != last)
+			{
+				if (*current.skipfield_pointer == 0)
+				{
+					if constexpr (!std::is_trivially_destructible<element_type>::value)
+					{
+						std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer)); // Destruct element
+					}
+
+					++number_of_group_erasures;
+					++current.element_pointer;
+					++current.skipfield_pointer;
+				}
+				else // remove skipblock from group:
+				{
+					const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer));
+					const skipfield_type next_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer) + 1);
+
+					current.element_pointer += *(current.skipfield_pointer);
+					current.skipfield_pointer += *(current.skipfield_pointer);
+
+					if (next_free_list_index == std::numeric_limits<skipfield_type>::max() && prev_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the last skipblock in the free list
+					{
+						the_group->free_list_head = std::numeric_limits<skipfield_type>::max(); // The group remains in the groups-with-erasures list, as a new skipblock is created below
+						number_of_group_erasures += static_cast<size_type>(last - current.element_pointer);
+
+						if constexpr (!std::is_trivially_destructible<element_type>::value)
+						{
+							while (current.element_pointer != last) // miniloop - avoid checking skipfield for rest of elements in group, as there are no more skipped elements now
+							{
+								std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer++)); // Destruct element
+							}
+						}
+
+						break; // end overall while loop
+					}
+					else if (next_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the head of the free list
+					{
+						the_group->free_list_head = prev_free_list_index; // make free list head equal to next free list node
+						*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_free_list_index) + 1) = std::numeric_limits<skipfield_type>::max();
+					}
+					else // either a tail or middle free list node
+					{
+						*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + next_free_list_index)) = prev_free_list_index;
+
+						if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the tail free list node
+						{
+							*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + prev_free_list_index) + 1) = next_free_list_index;
+						}
+					}
+				}
+			}
+		}
+
+
+		const skipfield_type distance_to_last = static_cast<skipfield_type>(last - first.element_pointer);
+		const skipfield_type index = static_cast<skipfield_type>(first.element_pointer - the_group->elements);
+
+		if (index == 0 || *(first.skipfield_pointer - 1) == 0) // element is either at start of group or previous skipfield node is 0
+		{
+			*(first.skipfield_pointer) = distance_to_last;
+			*(first.skipfield_pointer + distance_to_last - 1) = distance_to_last;
+
+			if (the_group->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + the_group->free_list_head) + 1) = index;
+			}
+
+			*(reinterpret_cast<skipfield_pointer_type>(first.element_pointer)) = the_group->free_list_head;
+			*(reinterpret_cast<skipfield_pointer_type>(first.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
+			the_group->free_list_head = index;
+		}
+		else // previous skipfield node is an end node in a skipblock
+		{
+			// Just update existing skipblock, no need to create new free list node:
+			const skipfield_type prev_node_value = *(first.skipfield_pointer - 1);
+			*(first.skipfield_pointer - prev_node_value) = static_cast<skipfield_type>(prev_node_value + distance_to_last);
+			*(first.skipfield_pointer + distance_to_last - 1) = static_cast<skipfield_type>(prev_node_value + distance_to_last);
+		}
+
+		return number_of_group_erasures;
+	}
+
+
+
+	// Destroys all elements in a non-empty group, without updating the skipfield:
+	void destroy_group_elements(const group_pointer_type the_group) noexcept
+	{
+		if constexpr (!std::is_trivially_destructible<element_type>::value)
+		{
+			iterator current = group_begin(the_group);
+			const aligned_pointer_type end = the_group->last_endpoint;
+
+			do
+			{
+				std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer)); // Destruct element
+				const skipfield_type skip = *(++current.skipfield_pointer);
+				current.element_pointer += static_cast<size_type>(skip) + 1u;
+				current.skipfield_pointer += skip;
+			} while (current.element_pointer != end);
+		}
+	}
+
+
+
+	// Marks the unused element locations at the end of the back group, from end onwards, as erased - used by splice():
+	static void mark_remainder_erased(const iterator &end) noexcept
+	{
+		const group_pointer_type the_group = end.group_pointer;
+		const skipfield_type distance_to_end = static_cast<skipfield_type>(the_group->end_of_elements() - end.element_pointer);
+		const skipfield_type previous_node_value = *(end.skipfield_pointer - 1);
+		the_group->last_endpoint = the_group->end_of_elements();
+
+		if (previous_node_value == 0) // no previous skipblock
+		{
+			*end.skipfield_pointer = distance_to_end;
+			*(end.skipfield_pointer + distance_to_end - 1) = distance_to_end;
+
+			const skipfield_type index = static_cast<skipfield_type>(end.element_pointer - the_group->elements);
+
+			if (the_group->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+			{
+				*(reinterpret_cast<skipfield_pointer_type>(the_group->elements + the_group->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
+			}
+
+			*(reinterpret_cast<skipfield_pointer_type>(end.element_pointer)) = the_group->free_list_head;
+			*(reinterpret_cast<skipfield_pointer_type>(end.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
+			the_group->free_list_head = index;
+		}
+		else
+		{ // update previous skipblock, no need to update free list:
+			*(end.skipfield_pointer - previous_node_value) = *(end.skipfield_pointer + distance_to_end - 1) = static_cast<skipfield_type>(previous_node_value + distance_to_end);
+		}
+	}
+
+}; // hive_occupancy
+
+// hive_priority::bitset - replaces the jump-counting skipfield with a per-group occupancy bitset (one bit per element rather than one or two bytes), and does not pad elements to hold an erased-element free list. Iteration finds the next or previous element via count-trailing/leading-zeros, while advance(), distance() and range-erase count elements a word at a time via popcount. Best suited to mostly-full hives with scattered erasures - long runs of erased elements are skipped a word (64 locations) at a time, rather than in a single jump as with the skipfield priorities:
+template <class element_type, class allocator_type> class hive_occupancy<element_type, allocator_type, plf::hive_priority::bitset> : public allocator_type // Empty base class optimisation (EBCO) - inheriting allocator functions
+{
+protected:
+	// Type-switching pattern:
+	template <bool flag, class is_true, class is_false> struct choose;
+
+	template <class is_true, class is_false> struct choose<true, is_true, is_false>
+	{
+		typedef is_true type;
+	};
+
+	template <class is_true, class is_false> struct choose<false, is_true, is_false>
+	{
+		typedef is_false type;
+	};
+
+	typedef unsigned short			capacity_type; // Group capacities have the same limits as hive_priority::performance
+	typedef unsigned long long		bitset_type; // A word of a group's occupancy bitset
+	static constexpr unsigned int	bitset_word_size = std::numeric_limits<bitset_type>::digits;
+
+public:
+	// Standard container typedefs:
+	typedef element_type value_type;
+	typedef typename std::aligned_storage<sizeof(element_type), alignof(element_type)>::type aligned_element_type; // No free list is stored in erased element locations, so no padding is necessary
+	typedef typename std::allocator_traits<allocator_type>::size_type 			size_type;
+	typedef typename std::allocator_traits<allocator_type>::difference_type 	difference_type;
+	typedef element_type &																		reference;
+	typedef const element_type &																const_reference;
+	typedef typename std::allocator_traits<allocator_type>::pointer				pointer;
+	typedef typename std::allocator_traits<allocator_type>::const_pointer		const_pointer;
+
+
+	// Iterator forward declarations:
+	template <bool is_const> class		hive_iterator;
+	typedef hive_iterator<false>			iterator;
+	typedef hive_iterator<true> 			const_iterator;
+	friend class hive_iterator<false>;
+	friend class hive_iterator<true>;
+
+	template <bool r_is_const> class 	hive_reverse_iterator;
+	typedef hive_reverse_iterator<false> reverse_iterator;
+	typedef hive_reverse_iterator<true>	const_reverse_iterator;
+	friend class hive_reverse_iterator<false>;
+	friend class hive_reverse_iterator<true>;
+
+
+
+protected:
+
+	static constexpr size_t allocation_alignment = (alignof(aligned_element_type) > alignof(bitset_type)) ? alignof(aligned_element_type) : alignof(bitset_type);
+
+	struct alignas(allocation_alignment) aligned_allocation_struct
+	{
+	  char data[allocation_alignment];
+	};
+
+
+	// forward declarations for typedefs below
+	struct group;
+
+
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_element_type>		aligned_element_allocator_type;
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group>							group_allocator_type;
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<bitset_type>					bitset_allocator_type;
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_allocation_struct> aligned_struct_allocator_type;
+
+	typedef typename std::allocator_traits<aligned_element_allocator_type>::pointer	aligned_pointer_type;
+	typedef typename std::allocator_traits<group_allocator_type>::pointer				group_pointer_type;
+	typedef typename std::allocator_traits<bitset_allocator_type>::pointer				bitset_pointer_type;
+	typedef typename std::allocator_traits<aligned_struct_allocator_type>::pointer	aligned_struct_pointer_type;
+
+	static constexpr bool trivial_pointers = std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<bitset_pointer_type>::value;
+
+
+	// A group's memory block holds its elements, followed by its bitset (aligned to bitset_type). These return sizes in bytes, words and multiples of aligned_allocation_struct respectively:
+	static constexpr size_type bitset_offset(const size_type elements_per_group) noexcept
+	{
+		return (((elements_per_group * sizeof(aligned_element_type)) + alignof(bitset_type) - 1) / alignof(bitset_type)) * alignof(bitset_type);
+	}
+
+
+	static constexpr size_type bitset_words(const size_type elements_per_group) noexcept
+	{
+		return (elements_per_group / bitset_word_size) + 1; // Always room for the sentinel bit at index capacity
+	}
+
+
+	static constexpr size_type aligned_block_size(const size_type elements_per_group) noexcept
+	{
+		return (bitset_offset(elements_per_group) + (bitset_words(elements_per_group) * sizeof(bitset_type)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct);
+	}
+
+
+
+	// Hive groups:
+	struct group : private aligned_struct_allocator_type	// ebco - inherit allocator functions
+	{
+		aligned_pointer_type 				last_endpoint; 			// The address which is one-past the highest element location that's been used so far in this group. Bits from here up to (but not including) the sentinel are always zero. As with the other priorities, iterator ++ uses this to reach end() in the back group
+		group_pointer_type					next_group; 				// Next group in the intrusive list of all groups. NULL if no next group.
+		const aligned_pointer_type 		elements;	 				// Element storage.
+		const bitset_pointer_type			bitset;						// Bit n is set when elements[n] holds an element. Bit 'capacity' is always set, as a sentinel which ends forward scans at the end of the group
+		group_pointer_type					previous_group; 			// Previous group in the intrusive list of all groups. NULL if no preceding group.
+		const capacity_type 				capacity;					// The element capacity of this particular group.
+		capacity_type 						size; 						// The total number of active elements in group.
+		capacity_type 						free_word;					// There are no erased element locations in bitset words before this one - the search for an erased location to reuse starts here
+		group_pointer_type					erasures_list_next_group; // The next group in the singly-linked list of groups with erasures ie. with erased locations below last_endpoint. NULL if no next group.
+		size_type								group_number;				// Used for comparison (> < >= <= <=>) iterator operators (used by distance function and user).
+
+
+		group(const capacity_type elements_per_group, group_pointer_type const previous, const size_type group_num):
+			last_endpoint(reinterpret_cast<aligned_pointer_type>(std::allocator_traits<aligned_struct_allocator_type>::allocate(*this, aligned_block_size(elements_per_group), (previous == NULL) ? 0 : previous->elements))),
+			next_group(NULL),
+			elements(last_endpoint++),
+			bitset(reinterpret_cast<bitset_pointer_type>(reinterpret_cast<unsigned char *>(&*elements) + bitset_offset(elements_per_group))),
+			previous_group(previous),
+			capacity(elements_per_group),
+			size(1),
+			free_word(0),
+			erasures_list_next_group(NULL),
+			group_number(group_num)
+		{
+			clear_bitset();
+			*bitset |= 1;
+		}
+
+
+		void reset(const capacity_type increment, const group_pointer_type next, const group_pointer_type previous, const size_type group_num) noexcept
+		{
+			last_endpoint = elements + increment;
+			next_group = next;
+			previous_group = previous;
+			size = increment;
+			free_word = 0;
+			erasures_list_next_group = NULL;
+			group_number = group_num;
+			clear_bitset();
+			set_bits(0, increment);
+		}
+
+
+		inline void clear_bitset() noexcept
+		{
+			std::memset(&*bitset, 0, sizeof(bitset_type) * bitset_words(capacity));
+			bitset[capacity / bitset_word_size] = bitset_type(1) << (capacity % bitset_word_size);
+		}
+
+
+		void set_bits(const size_type first, const size_type last) noexcept // Marks the locations with indexes in [first, last) as holding elements
+		{
+			if (first >= last)
+			{
+				return;
+			}
+
+			const size_type first_word = first / bitset_word_size, last_word = (last - 1) / bitset_word_size;
+			const bitset_type first_mask = ~bitset_type(0) << (first % bitset_word_size), last_mask = ~bitset_type(0) >> ((bitset_word_size - 1) - ((last - 1) % bitset_word_size));
+
+			if (first_word == last_word)
+			{
+				bitset[first_word] |= first_mask & last_mask;
+				return;
+			}
+
+			bitset[first_word] |= first_mask;
+
+			for (size_type word = first_word + 1; word != last_word; ++word)
+			{
+				bitset[word] = ~bitset_type(0);
+			}
+
+			bitset[last_word] |= last_mask;
+		}
+
+
+		inline bool has_erasures() const noexcept // ie. erased locations exist below last_endpoint, and the group is in the groups-with-erasures list
+		{
+			return static_cast<size_type>(last_endpoint - elements) != size;
+		}
+
+
+		inline aligned_pointer_type end_of_elements() const noexcept
+		{
+			return elements + capacity;
+		}
+
+
+		inline void copy_erasure_state(const group &source) noexcept // For groups whose memory block, including the bitset, has been copied from the source's
+		{
+			free_word = source.free_word;
+		}
+
+
+		~group() noexcept
+		{
+			std::allocator_traits<aligned_struct_allocator_type>::deallocate(*this, reinterpret_cast<aligned_struct_pointer_type>(elements), aligned_block_size(capacity));
+		}
+	};
+
+
+
+	// Bitset scans:
+
+	// Index of the first element at or after index, or the_group->capacity if there is none (the sentinel bit ends the scan):
+	static size_type next_element_index(const group_pointer_type the_group, const size_type index) noexcept
+	{
+		bitset_pointer_type word = the_group->bitset + (index / bitset_word_size);
+		const bitset_type bits = *word >> (index % bitset_word_size);
+
+		if (bits != 0) // Most common case - an element later in the same word
+		{
+			return index + static_cast<size_type>(std::countr_zero(bits));
+		}
+
+		while (*++word == 0) {}
+
+		return (static_cast<size_type>(word - the_group->bitset) * bitset_word_size) + static_cast<size_type>(std::countr_zero(*word));
+	}
+
+
+
+	// Index of the last element before index, or std::numeric_limits<size_type>::max() if there is none:
+	static size_type previous_element_index(const group_pointer_type the_group, const size_type index) noexcept
+	{
+		if (index == 0)
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+		bitset_pointer_type word = the_group->bitset + ((index - 1) / bitset_word_size);
+		bitset_type bits = *word & (~bitset_type(0) >> ((bitset_word_size - 1) - ((index - 1) % bitset_word_size)));
+
+		while (bits == 0)
+		{
+			if (word == the_group->bitset)
+			{
+				return std::numeric_limits<size_type>::max();
+			}
+
+			bits = *--word;
+		}
+
+		return (static_cast<size_type>(word - the_group->bitset) * bitset_word_size) + (bitset_word_size - 1) - static_cast<size_type>(std::countl_zero(bits));
+	}
+
+
+
+	// Number of elements with indexes in [first, last), where last <= capacity:
+	static size_type count_elements(const group_pointer_type the_group, const size_type first, const size_type last) noexcept
+	{
+		if (first >= last)
+		{
+			return 0;
+		}
+
+		const size_type first_word = first / bitset_word_size, last_word = (last - 1) / bitset_word_size;
+		const bitset_type first_mask = ~bitset_type(0) << (first % bitset_word_size), last_mask = ~bitset_type(0) >> ((bitset_word_size - 1) - ((last - 1) % bitset_word_size));
+
+		if (first_word == last_word)
+		{
+			return static_cast<size_type>(std::popcount(the_group->bitset[first_word] & first_mask & last_mask));
+		}
+
+		size_type count = static_cast<size_type>(std::popcount(the_group->bitset[first_word] & first_mask));
+
+		for (size_type word = first_word + 1; word != last_word; ++word)
+		{
+			count += static_cast<size_type>(std::popcount(the_group->bitset[word]));
+		}
+
+		return count + static_cast<size_type>(std::popcount(the_group->bitset[last_word] & last_mask));
+	}
+
+
+
+	// Index of the distance'th element at or after index. If there are fewer, returns the_group->capacity and subtracts the number found from distance:
+	static size_type select_forwards(const group_pointer_type the_group, const size_type index, difference_type &distance) noexcept
+	{
+		const bitset_pointer_type sentinel_word = the_group->bitset + (the_group->capacity / bitset_word_size);
+		bitset_pointer_type word = the_group->bitset + (index / bitset_word_size);
+		bitset_type bits = *word & (~bitset_type(0) << (index % bitset_word_size));
+
+		while (true)
+		{
+			if (word == sentinel_word)
+			{
+				bits &= ~(bitset_type(1) << (the_group->capacity % bitset_word_size));
+			}
+
+			const difference_type count = static_cast<difference_type>(std::popcount(bits));
+
+			if (count >= distance)
+			{
+				while (--distance != 0)
+				{
+					bits &= bits - 1; // Clear lowest element bit
+				}
+
+				return (static_cast<size_type>(word - the_group->bitset) * bitset_word_size) + static_cast<size_type>(std::countr_zero(bits));
+			}
+
+			distance -= count;
+
+			if (word == sentinel_word)
+			{
+				return the_group->capacity;
+			}
+
+			bits = *++word;
+		}
+	}
+
+
+
+	// Index of the distance'th element before index. If there are fewer, returns std::numeric_limits<size_type>::max() and subtracts the number found from distance:
+	static size_type select_backwards(const group_pointer_type the_group, const size_type index, difference_type &distance) noexcept
+	{
+		if (index == 0)
+		{
+			return std::numeric_limits<size_type>::max();
+		}
+
+		bitset_pointer_type word = the_group->bitset + ((index - 1) / bitset_word_size);
+		bitset_type bits = *word & (~bitset_type(0) >> ((bitset_word_size - 1) - ((index - 1) % bitset_word_size)));
+
+		while (true)
+		{
+			const difference_type count = static_cast<difference_type>(std::popcount(bits));
+
+			if (count >= distance)
+			{
+				while (--distance != 0)
+				{
+					bits &= ~(bitset_type(1) << ((bitset_word_size - 1) - static_cast<unsigned int>(std::countl_zero(bits)))); // Clear highest element bit
+				}
+
+				return (static_cast<size_type>(word - the_group->bitset) * bitset_word_size) + (bitset_word_size - 1) - static_cast<size_type>(std::countl_zero(bits));
+			}
+
+			distance -= count;
+
+			if (word == the_group->bitset)
+			{
+				return std::numeric_limits<size_type>::max();
+			}
+
+			bits = *--word;
+		}
+	}
+
+
+
+public:
+
+	// Iterators:
+	template <bool is_const> class hive_iterator
+	{
+	private:
+		group_pointer_type		group_pointer;
+		aligned_pointer_type 	element_pointer;
+
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef typename hive_occupancy::value_type 		value_type;
+		typedef typename hive_occupancy::difference_type	difference_type;
+		typedef typename choose<is_const, typename hive_occupancy::const_pointer, typename hive_occupancy::pointer>::type		pointer;
+		typedef typename choose<is_const, typename hive_occupancy::const_reference, typename hive_occupancy::reference>::type reference;
+
+		friend class hive_occupancy;
+		friend class plf::hive<element_type, allocator_type, plf::hive_priority::bitset>;
+		friend class hive_reverse_iterator<false>;
+		friend class hive_reverse_iterator<true>;
+
+
+
+		inline hive_iterator & operator = (const hive_iterator &source) noexcept
+		{
+			group_pointer = source.group_pointer;
+			element_pointer = source.element_pointer;
+			return *this;
+		}
+
+
+
+		inline hive_iterator & operator = (const hive_iterator<!is_const> &source) noexcept
+		{
+			group_pointer = source.group_pointer;
+			element_pointer = source.element_pointer;
+			return *this;
+		}
+
+
+
+		inline bool operator == (const hive_iterator &rh) const noexcept
+		{
+			return (element_pointer == rh.element_pointer);
+		}
+
+
+
+		inline bool operator == (const hive_iterator<!is_const> &rh) const noexcept
+		{
+			return (element_pointer == rh.element_pointer);
+		}
+
+
+
+		inline bool operator != (const hive_iterator &rh) const noexcept
+		{
+			return (element_pointer != rh.element_pointer);
+		}
+
+
+
+		inline bool operator != (const hive_iterator<!is_const> &rh) const noexcept
+		{
+			return (element_pointer != rh.element_pointer);
+		}
+
+
+
+		inline reference operator * () const // may cause exception with uninitialized iterator
+		{
+			return *(reinterpret_cast<pointer>(element_pointer));
+		}
+
+
+
+		inline pointer operator -> () const noexcept
+		{
+			return reinterpret_cast<pointer>(element_pointer);
+		}
+
+
+
+		hive_iterator & operator ++ ()
+		{
+			assert(group_pointer != NULL); // covers uninitialised hive_iterator
+			size_type index = static_cast<size_type>(element_pointer - group_pointer->elements) + 1u;
+
+			if (((group_pointer->bitset[index / bitset_word_size] >> (index % bitset_word_size)) & 1) && index != group_pointer->capacity) // Most common case - the next location holds an element. Checked separately so that the branch can be predicted, rather than the next element's location depending on the bitset load
+			{
+				++element_pointer;
+				return *this;
+			}
+
+			index = next_element_index(group_pointer, index);
+
+			if (index != group_pointer->capacity)
+			{
+				element_pointer = group_pointer->elements + index;
+			}
+			else if (group_pointer->next_group != NULL) // Groups other than a sole remaining group are never empty, so the next group always has a first element
+			{
+				group_pointer = group_pointer->next_group;
+				element_pointer = group_pointer->elements + next_element_index(group_pointer, 0);
+			}
+			else
+			{
+				element_pointer = group_pointer->last_endpoint; // ie. end()
+			}
+
+			return *this;
+		}
+
+
+
+		inline hive_iterator operator ++(int)
+		{
+			const hive_iterator copy(*this);
+			++*this;
+			return copy;
+		}
+
+
+
+		hive_iterator & operator -- ()
+		{
+			assert(group_pointer != NULL);
+			size_type index = previous_element_index(group_pointer, static_cast<size_type>(element_pointer - group_pointer->elements));
+
+			if (index == std::numeric_limits<size_type>::max()) // ie. no preceding element in this group
+			{
+				group_pointer = group_pointer->previous_group;
+				index = previous_element_index(group_pointer, group_pointer->capacity);
+			}
+
+			element_pointer = group_pointer->elements + index;
+			return *this;
+		}
+
+
+
+		inline hive_iterator operator -- (int)
+		{
+			const hive_iterator copy(*this);
+			--*this;
+			return copy;
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator > (const hive_iterator<is_const_it> &rh) const noexcept
+		{
+			return ((group_pointer == rh.group_pointer) & (element_pointer > rh.element_pointer)) || (group_pointer != rh.group_pointer && group_pointer->group_number > rh.group_pointer->group_number);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator < (const hive_iterator<is_const_it> &rh) const noexcept
+		{
+			return rh > *this;
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator >= (const hive_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(rh > *this);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator <= (const hive_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(*this > rh);
+		}
+
+
+
+		template <bool is_const_it>
+		inline int operator <=> (const hive_iterator<is_const_it> &rh) const noexcept
+		{
+			return (element_pointer == rh.element_pointer) ? 0 : ((*this > rh) ? 1 : -1);
+		}
+
+
+
+		hive_iterator() noexcept: group_pointer(NULL), element_pointer(NULL) {}
+
+
+
+	private:
+		// Used by cend(), erase() etc:
+		hive_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p) noexcept: group_pointer(group_p), element_pointer(element_p) {}
+
+
+	public:
+
+		// Friend functions:
+
+		template <class distance_type>
+		friend inline void advance(hive_iterator &it, distance_type distance)
+		{
+			it.advance(static_cast<difference_type>(distance));
+		}
+
+
+
+		friend inline hive_iterator next(const hive_iterator &it, const difference_type distance)
+		{
+			hive_iterator return_iterator(it);
+			return_iterator.advance(static_cast<difference_type>(distance));
+			return return_iterator;
+		}
+
+
+
+		friend inline hive_iterator prev(const hive_iterator &it, const difference_type distance)
+		{
+			hive_iterator return_iterator(it);
+			return_iterator.advance(-(static_cast<difference_type>(distance)));
+			return return_iterator;
+		}
+
+
+
+		friend inline typename hive_iterator::difference_type distance(const hive_iterator &first, const hive_iterator &last)
+		{
+			return first.distance(last);
+		}
+
+
+
+	private:
+
+		// Advance implementation:
+
+		inline void advance(const difference_type distance) // Cannot be noexcept due to the possibility of an uninitialized iterator
+		{
+			if (distance > 0)
+			{
+				advance_forwards(distance);
+			}
+			else if (distance < 0)
+			{
+				advance_backwards(-distance);
+			}
+		}
+
+
+
+		// Counts elements via popcount in the initial and final groups, and skips intermediate groups using their sizes. Bounded to end():
+		void advance_forwards(difference_type distance)
+		{
+			assert(group_pointer != NULL); // covers uninitialized hive_iterator && empty group
+			assert(!(element_pointer == group_pointer->last_endpoint && group_pointer->next_group == NULL)); // Check that we're not already at end()
+
+			size_type index = select_forwards(group_pointer, static_cast<size_type>(element_pointer - group_pointer->elements) + 1u, distance);
+
+			while (index == group_pointer->capacity)
+			{
+				do
+				{
+					if (group_pointer->next_group == NULL) // either we've reached end() or gone beyond it, so bound to end()
+					{
+						element_pointer = group_pointer->last_endpoint;
+						return;
+					}
+
+					group_pointer = group_pointer->next_group;
+				} while (static_cast<difference_type>(group_pointer->size) < distance && (distance -= group_pointer->size, true));
+
+				index = select_forwards(group_pointer, 0, distance);
+			}
+
+			element_pointer = group_pointer->elements + index;
+		}
+
+
+
+		// As above, but bounded to begin(). Returns true if there were fewer than distance elements before the iterator:
+		bool advance_backwards(difference_type distance)
+		{
+			assert(group_pointer != NULL);
+
+			size_type index = select_backwards(group_pointer, static_cast<size_type>(element_pointer - group_pointer->elements), distance);
+
+			while (index == std::numeric_limits<size_type>::max())
+			{
+				do
+				{
+					if (group_pointer->previous_group == NULL) // we've gone beyond begin(), so bound to it
+					{
+						element_pointer = group_pointer->elements + next_element_index(group_pointer, 0);
+						return true;
+					}
+
+					group_pointer = group_pointer->previous_group;
+				} while (static_cast<difference_type>(group_pointer->size) < distance && (distance -= group_pointer->size, true));
+
+				index = select_backwards(group_pointer, group_pointer->capacity, distance);
+			}
+
+			element_pointer = group_pointer->elements + index;
+			return false;
+		}
+
+
+
+		// distance implementation - the number of elements in [first, last), counted via popcount in the initial and final groups, with intermediate groups' sizes summed. The first iterator may be at rend()'s position, one before the first element:
+		difference_type distance(const hive_iterator &last) const
+		{
+			if (element_pointer == last.element_pointer)
+			{
+				return 0;
+			}
+
+			const bool swap = (*this > last);
+			const hive_iterator &first_iterator = (swap) ? last : *this, &last_iterator = (swap) ? *this : last;
+			const difference_type first_offset = first_iterator.element_pointer - first_iterator.group_pointer->elements;
+			difference_type distance = (first_offset < 0) ? 1 : 0; // ie. rend() is one before the first element
+			const size_type first_index = (first_offset < 0) ? 0 : static_cast<size_type>(first_offset), last_index = static_cast<size_type>(last_iterator.element_pointer - last_iterator.group_pointer->elements);
+
+			if (first_iterator.group_pointer == last_iterator.group_pointer)
+			{
+				distance += static_cast<difference_type>(count_elements(first_iterator.group_pointer, first_index, last_index));
+			}
+			else
+			{
+				distance += static_cast<difference_type>(count_elements(first_iterator.group_pointer, first_index, first_iterator.group_pointer->capacity));
+
+				for (group_pointer_type current = first_iterator.group_pointer->next_group; current != last_iterator.group_pointer; current = current->next_group)
+				{
+					distance += static_cast<difference_type>(current->size);
+				}
+
+				distance += static_cast<difference_type>(count_elements(last_iterator.group_pointer, 0, last_index));
+			}
+
+			return (swap) ? -distance : distance;
+		}
+
+
+
+	public:
+
+		inline hive_iterator (const hive_iterator &source) noexcept:
+			group_pointer(source.group_pointer),
+			element_pointer(source.element_pointer)
+		{}
+
+
+		inline hive_iterator(const hive_iterator<!is_const> &source) noexcept:
+			group_pointer(source.group_pointer),
+			element_pointer(source.element_pointer)
+		{}
+
+	}; // hive_iterator
+
+
+
+
+
+	// Reverse iterators:
+
+	template <bool r_is_const> class hive_reverse_iterator
+	{
+	private:
+		iterator it;
+
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef typename hive_occupancy::value_type 		value_type;
+		typedef typename hive_occupancy::difference_type	difference_type;
+		typedef typename choose<r_is_const, typename hive_occupancy::const_pointer, typename hive_occupancy::pointer>::type		pointer;
+		typedef typename choose<r_is_const, typename hive_occupancy::const_reference, typename hive_occupancy::reference>::type	reference;
+
+		friend class hive_occupancy;
+		friend class plf::hive<element_type, allocator_type, plf::hive_priority::bitset>;
+
+
+		inline hive_reverse_iterator& operator = (const hive_reverse_iterator &source) noexcept
+		{
+			it = source.it;
+			return *this;
+		}
+
+
+
+		inline hive_reverse_iterator& operator = (const hive_reverse_iterator<!r_is_const> &source) noexcept
+		{
+			it = source.it;
+			return *this;
+		}
+
+
+
+		template <bool is_const_it>
+		inline hive_reverse_iterator& operator = (const hive_iterator<is_const_it> &source) noexcept
+		{
+			it = source;
+			return *this;
+		}
+
+
+
+		inline bool operator == (const hive_reverse_iterator &rh) const noexcept
+		{
+			return (it == rh.it);
+		}
+
+
+
+		inline bool operator == (const hive_reverse_iterator<!r_is_const> &rh) const noexcept
+		{
+			return (it == rh.it);
+		}
+
+
+
+		inline bool operator != (const hive_reverse_iterator &rh) const noexcept
+		{
+			return (it != rh.it);
+		}
+
+
+
+		inline bool operator != (const hive_reverse_iterator<!r_is_const> &rh) const noexcept
+		{
+			return (it != rh.it);
+		}
+
+
+
+		inline reference operator * () const noexcept
+		{
+			return *(reinterpret_cast<pointer>(it.element_pointer));
+		}
+
+
+
+		inline pointer operator -> () const noexcept
+		{
+			return reinterpret_cast<pointer>(it.element_pointer);
+		}
+
+
+
+		// In this case we have to redefine the algorithm, rather than using the internal iterator's -- operator, in order for the reverse_iterator to be allowed to reach rend() ie. begin_iterator - 1
+		hive_reverse_iterator & operator ++ ()
+		{
+			hive_occupancy::group_pointer_type &group_pointer = it.group_pointer;
+			hive_occupancy::aligned_pointer_type &element_pointer = it.element_pointer;
+
+			assert(group_pointer != NULL);
+			size_type index = previous_element_index(group_pointer, static_cast<size_type>(element_pointer - group_pointer->elements));
+
+			if (index == std::numeric_limits<size_type>::max()) // ie. no preceding element in this group
+			{
+				if (group_pointer->previous_group == NULL) // necessary so that reverse_iterator can end up == rend(), if we were already at first element in hive
+				{
+					element_pointer = group_pointer->elements - 1;
+					return *this;
+				}
+
+				group_pointer = group_pointer->previous_group;
+				index = previous_element_index(group_pointer, group_pointer->capacity);
+			}
+
+			element_pointer = group_pointer->elements + index;
+			return *this;
+		}
+
+
+
+		inline hive_reverse_iterator operator ++ (int)
+		{
+			const hive_reverse_iterator copy(*this);
+			++*this;
+			return copy;
+		}
+
+
+
+		inline hive_reverse_iterator & operator -- ()
+		{
+			++it; // Forward scans from rend()'s position start at index 0
+			return *this;
+		}
+
+
+
+		inline hive_reverse_iterator operator -- (int)
+		{
+			const hive_reverse_iterator copy(*this);
+			--*this;
+			return copy;
+		}
+
+
+
+		inline typename hive_occupancy::iterator base() const
+		{
+			return ++(typename hive_occupancy::iterator(it));
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator > (const hive_reverse_iterator<is_const_it> &rh) const noexcept
+		{
+			return (rh.it > it);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator < (const hive_reverse_iterator<is_const_it> &rh) const noexcept
+		{
+			return (it > rh.it);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator >= (const hive_reverse_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(it > rh.it);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator <= (const hive_reverse_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(rh.it > it);
+		}
+
+
+
+		template <bool is_const_it>
+		inline int operator <=> (const hive_reverse_iterator<is_const_it> &rh) const noexcept
+		{
+			return (rh.it <=> it);
+		}
+
+
+
+		hive_reverse_iterator () noexcept
+		{}
+
+
+
+		hive_reverse_iterator (const hive_reverse_iterator &source) noexcept:
+			it(source.it)
+		{}
+
+
+
+		hive_reverse_iterator (const hive_reverse_iterator<!r_is_const> &source) noexcept:
+			it(source.it)
+		{}
+
+
+
+		template<bool is_const>
+		explicit hive_reverse_iterator (const hive_iterator<is_const> &source) noexcept:
+			it(source)
+		{}
+
+
+
+	private:
+		// Used by rend(), etc:
+		hive_reverse_iterator(const group_pointer_type group_p, const aligned_pointer_type element_p) noexcept: it(group_p, element_p) {}
+
+
+
+	public:
+		// Friend functions:
+
+		template <class distance_type>
+		friend inline void advance(hive_reverse_iterator &it, distance_type distance)
+		{
+			it.advance(static_cast<difference_type>(distance));
+		}
+
+
+
+		friend inline hive_reverse_iterator next(const hive_reverse_iterator &it, const difference_type distance)
+		{
+			hive_reverse_iterator return_iterator(it);
+			return_iterator.advance(static_cast<difference_type>(distance));
+			return return_iterator;
+		}
+
+
+
+		friend inline hive_reverse_iterator prev(const hive_reverse_iterator &it, const difference_type distance)
+		{
+			hive_reverse_iterator return_iterator(it);
+			return_iterator.advance(-(static_cast<difference_type>(distance)));
+			return return_iterator;
+		}
+
+
+
+		friend inline typename hive_reverse_iterator::difference_type distance(const hive_reverse_iterator &first, const hive_reverse_iterator &last)
+		{
+			return first.distance(last);
+		}
+
+
+
+		// distance implementation:
+
+		inline difference_type distance(const hive_reverse_iterator &last) const
+		{
+			return last.it.distance(it);
+		}
+
+
+
+	private:
+
+		// Advance for reverse_iterator and const_reverse_iterator - bounded to rend() rather than begin() when moving backwards through the hive:
+		void advance(const difference_type distance)
+		{
+			if (distance > 0)
+			{
+				if (it.advance_backwards(distance))
+				{
+					it.element_pointer = it.group_pointer->elements - 1;
+				}
+			}
+			else if (distance < 0)
+			{
+				it.advance_forwards(-distance);
+			}
+		}
+
+	}; // hive_reverse_iterator
+
+
+
+
+
+
+protected:
+
+	explicit hive_occupancy(const allocator_type &alloc) noexcept:
+		allocator_type(alloc)
+	{}
+
+
+
+	// Occupancy marking functions - see the primary template:
+
+	static inline iterator group_begin(const group_pointer_type the_group) noexcept
+	{
+		return iterator(the_group, the_group->elements + next_element_index(the_group, 0));
+	}
+
+
+
+	static inline iterator group_end(const group_pointer_type the_group) noexcept
+	{
+		return iterator(the_group, the_group->last_endpoint);
+	}
+
+
+
+	static inline bool is_element(const group_pointer_type the_group, const aligned_pointer_type location) noexcept
+	{
+		const size_type index = static_cast<size_type>(location - the_group->elements);
+		return (the_group->bitset[index / bitset_word_size] >> (index % bitset_word_size)) & 1;
+	}
+
+
+
+	static inline void mark_appended(iterator &end) noexcept
+	{
+		const group_pointer_type the_group = end.group_pointer;
+		const size_type index = static_cast<size_type>(end.element_pointer - the_group->elements);
+		the_group->bitset[index / bitset_word_size] |= bitset_type(1) << (index % bitset_word_size);
+		the_group->last_endpoint = ++end.element_pointer;
+		++(the_group->size);
+	}
+
+
+
+	static inline void mark_filled(iterator &end) noexcept
+	{
+		const group_pointer_type the_group = end.group_pointer;
+		the_group->set_bits(static_cast<size_type>(the_group->last_endpoint - the_group->elements), static_cast<size_type>(end.element_pointer - the_group->elements));
+		the_group->size = static_cast<capacity_type>(the_group->size + (end.element_pointer - the_group->last_endpoint));
+		the_group->last_endpoint = end.element_pointer;
+	}
+
+
+
+	template <typename... arguments>
+	iterator construct_in_erased_location(const group_pointer_type the_group, arguments &&... parameters)
+	{
+		bitset_pointer_type word = the_group->bitset + the_group->free_word;
+
+		while (*word == ~bitset_type(0)) // The group's first erased location is the first zero bit at or after free_word, and is below last_endpoint
+		{
+			++word;
+		}
+
+		const size_type index = (static_cast<size_type>(word - the_group->bitset) * bitset_word_size) + static_cast<size_type>(std::countr_zero(~*word));
+		std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(the_group->elements + index), std::forward<arguments>(parameters) ...);
+		*word |= bitset_type(1) << (index % bitset_word_size);
+		the_group->free_word = static_cast<capacity_type>(word - the_group->bitset);
+		++(the_group->size);
+		return iterator(the_group, the_group->elements + index);
+	}
+
+
+
+	void fill_erased_locations(const group_pointer_type the_group, size_type size, const element_type &element)
+	{
+		do
+		{
+			construct_in_erased_location(the_group, element);
+		} while (--size != 0 && the_group->has_erasures());
+	}
+
+
+
+	template <class iterator_type>
+	iterator_type range_fill_erased_locations(const group_pointer_type the_group, size_type size, iterator_type it)
+	{
+		do
+		{
+			construct_in_erased_location(the_group, *it);
+			++it;
+		} while (--size != 0 && the_group->has_erasures());
+
+		return it;
+	}
+
+
+
+	static iterator mark_erased(const const_iterator &it) noexcept
+	{
+		const group_pointer_type the_group = it.group_pointer;
+		const size_type word = static_cast<size_type>(it.element_pointer - the_group->elements) / bitset_word_size;
+		the_group->bitset[word] &= ~(bitset_type(1) << (static_cast<size_type>(it.element_pointer - the_group->elements) % bitset_word_size));
+
+		if (word < the_group->free_word)
+		{
+			the_group->free_word = static_cast<capacity_type>(word);
+		}
+
+		iterator return_iterator(the_group, it.element_pointer);
+		return ++return_iterator;
+	}
+
+
+
+	// Destroys the elements in [first, last) and clears their bits, a bitset word at a time:
+	size_type erase_in_group(const const_iterator first, const aligned_pointer_type last) noexcept
+	{
+		const group_pointer_type the_group = first.group_pointer;
+		const size_type first_index = static_cast<size_type>(first.element_pointer - the_group->elements), last_index = static_cast<size_type>(last - the_group->elements);
+
+		if (first_index >= last_index)
+		{
+			return 0;
+		}
+
+		const size_type first_word = first_index / bitset_word_size, last_word = (last_index - 1) / bitset_word_size;
+		size_type count = 0;
+
+		for (size_type word = first_word; word <= last_word; ++word)
+		{
+			bitset_type mask = ~bitset_type(0);
+
+			if (word == first_word)
+			{
+				mask &= ~bitset_type(0) << (first_index % bitset_word_size);
+			}
+
+			if (word == last_word)
+			{
+				mask &= ~bitset_type(0) >> ((bitset_word_size - 1) - ((last_index - 1) % bitset_word_size));
+			}
+
+			bitset_type bits = the_group->bitset[word] & mask;
+			count += static_cast<size_type>(std::popcount(bits));
+
+			if constexpr (!std::is_trivially_destructible<element_type>::value)
+			{
+				while (bits != 0)
+				{
+					std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(the_group->elements + ((word * bitset_word_size) + static_cast<size_type>(std::countr_zero(bits)))));
+					bits &= bits - 1;
+				}
+			}
+
+			the_group->bitset[word] &= ~mask;
+		}
+
+		if (first_word < the_group->free_word)
+		{
+			the_group->free_word = static_cast<capacity_type>(first_word);
+		}
+
+		return count;
+	}
+
+
+
+	void destroy_group_elements(const group_pointer_type the_group) noexcept
+	{
+		if constexpr (!std::is_trivially_destructible<element_type>::value)
+		{
+			const size_type last_index = static_cast<size_type>(the_group->last_endpoint - the_group->elements);
+
+			for (size_type word = 0; word * bitset_word_size < last_index; ++word)
+			{
+				bitset_type bits = the_group->bitset[word];
+
+				if ((word + 1) * bitset_word_size > last_index) // Mask out the sentinel bit
+				{
+					bits &= ~bitset_type(0) >> (bitset_word_size - (last_index % bitset_word_size));
+				}
+
+				while (bits != 0)
+				{
+					std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(the_group->elements + ((word * bitset_word_size) + static_cast<size_type>(std::countr_zero(bits)))));
+					bits &= bits - 1;
+				}
+			}
+		}
+	}
+
+
+
+	static void mark_remainder_erased(const iterator &end) noexcept
+	{
+		const group_pointer_type the_group = end.group_pointer;
+		const size_type word = static_cast<size_type>(end.element_pointer - the_group->elements) / bitset_word_size; // Bits are already clear from here onwards
+
+		if (word < the_group->free_word)
+		{
+			the_group->free_word = static_cast<capacity_type>(word);
+		}
+
+		the_group->last_endpoint = the_group->end_of_elements();
+	}
+
+}; // hive_occupancy
+
+
+
+template <class element_type, class allocator_type = std::allocator<element_type>, plf::hive_priority priority = plf::hive_priority::performance> class hive : private plf::hive_occupancy<element_type, allocator_type, priority>
+{
+	typedef plf::hive_occupancy<element_type, allocator_type, priority> occupancy;
+
+public:
+	// Standard container typedefs:
+	typedef typename occupancy::value_type					value_type;
+	typedef typename occupancy::aligned_element_type		aligned_element_type;
+	typedef typename occupancy::size_type					size_type;
+	typedef typename occupancy::difference_type				difference_type;
+	typedef typename occupancy::reference					reference;
+	typedef typename occupancy::const_reference				const_reference;
+	typedef typename occupancy::pointer						pointer;
+	typedef typename occupancy::const_pointer				const_pointer;
+
+	// Iterators:
+	template <bool is_const> using hive_iterator = typename occupancy::template hive_iterator<is_const>;
+	typedef typename occupancy::iterator					iterator;
+	typedef typename occupancy::const_iterator				const_iterator;
+
+	template <bool r_is_const> using hive_reverse_iterator = typename occupancy::template hive_reverse_iterator<r_is_const>;
+	typedef typename occupancy::reverse_iterator			reverse_iterator;
+	typedef typename occupancy::const_reverse_iterator	const_reverse_iterator;
+
+
+
+private:
+
+	typedef typename occupancy::capacity_type					capacity_type;
+	typedef typename occupancy::group							group;
+	typedef typename occupancy::group_pointer_type			group_pointer_type;
+	typedef typename occupancy::aligned_pointer_type		aligned_pointer_type;
+	typedef typename occupancy::aligned_allocation_struct	aligned_allocation_struct;
+	typedef typename occupancy::group_allocator_type		group_allocator_type;
+
+	struct item_index_tuple; // for use in sort()
+
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<item_index_tuple> 			tuple_allocator_type;
+	typedef typename std::allocator_traits<tuple_allocator_type>::pointer				tuple_pointer_type;
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group_pointer_type>					group_pointer_allocator_type;
+	typedef typename std::allocator_traits<group_pointer_allocator_type>::pointer	group_pointer_pointer_type;
+
+	using occupancy::aligned_block_size;
+	using occupancy::group_begin;
+	using occupancy::group_end;
+	using occupancy::is_element;
+	using occupancy::mark_appended;
+	using occupancy::mark_filled;
+	using occupancy::construct_in_erased_location;
+	using occupancy::fill_erased_locations;
+	using occupancy::range_fill_erased_locations;
+	using occupancy::mark_erased;
+	using occupancy::erase_in_group;
+	using occupancy::destroy_group_elements;
+	using occupancy::mark_remainder_erased;
+
+
+private:
+
+	// Colony Member variables:
+
+	iterator 				end_iterator, begin_iterator;
+	group_pointer_type	groups_with_erasures_list_head,	// Head of the singly-linked list of groups which have erased-element memory locations available for re-use
+								unused_groups_head;					// Head of singly-linked list of groups retained by erase()/clear() or created by reserve()
+	size_type				total_size, total_capacity;
+
+	struct ebco_pair2 : tuple_allocator_type // Packaging the element pointer allocator with a lesser-used member variable, for empty-base-class optimisation
+	{
+		capacity_type min_group_capacity;
+		explicit ebco_pair2(const capacity_type min_elements) noexcept: min_group_capacity(min_elements) {}
+	}							tuple_allocator_pair;
+
+	struct ebco_pair : group_allocator_type
+	{
+		capacity_type max_group_capacity;
+		explicit ebco_pair(const capacity_type max_elements) noexcept: max_group_capacity(max_elements) {}
+	}							group_allocator_pair;
+
+	struct group_address_index // All allocated groups (active and unused), sorted by element memory address, for get_iterator()
+	{
+		group_pointer_pointer_type groups;
+		size_type number_of_groups, capacity;
+		bool stale; // Set when groups are allocated or deallocated, or the hive's contents are moved or swapped - the index is then rebuilt by the next get_iterator() call
+	};
+
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group_address_index>	group_index_allocator_type;
+	typedef typename std::allocator_traits<group_index_allocator_type>::pointer									group_index_pointer_type;
+
+	struct group_index_holder // Belongs to the hive object rather than its contents, so is not transferred by move or swap. NULL unless enabled via enable_group_index()
+	{
+		group_index_pointer_type index;
+		group_index_holder() noexcept: index(NULL) {}
+	}							group_index;
+
+
+
+	// An adaptive minimum based around sizeof(element_type), sizeof(group) and sizeof(hive):
+	#define PLF_MIN_BLOCK_CAPACITY (sizeof(aligned_element_type) * 8 > (sizeof(plf::hive<element_type>) + sizeof(group)) * 2) ? 8 : (((sizeof(plf::hive<element_type>) + sizeof(group)) * 2) / sizeof(aligned_element_type))
+
+
+
+	inline void check_capacities_conformance(plf::hive_limits capacities) const
+	{
+		if (capacities.min < 2 || capacities.min > capacities.max || capacities.max > std::numeric_limits<capacity_type>::max())
+		{
+			throw std::length_error("Supplied memory block capacities outside of allowable ranges");
+		}
+	}
+
+
+
+public:
+
+	// Default constructor:
+
+	hive():
+		occupancy(allocator_type()),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
+		group_allocator_pair(std::numeric_limits<capacity_type>::max())
+	{}
+
+
+
+	explicit hive(const plf::hive_limits capacities):
+		occupancy(allocator_type()),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+	}
+
+
+
+	// Default constructor (allocator-extended):
+
+	explicit hive(const allocator_type &alloc):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(PLF_MIN_BLOCK_CAPACITY),
+		group_allocator_pair(std::numeric_limits<capacity_type>::max())
+	{}
+
+
+
+	explicit hive(const plf::hive_limits capacities, const allocator_type &alloc):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+	}
+
+
+
+	// Copy constructor:
+
+	hive(const hive &source):
+		occupancy(source),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	{ // can skip checking for capacity conformance here as the capacity limits must be equal between the destination and source, and source will have already had theirs checked. Same applies for other copy and move constructors below
+		if constexpr (std::is_trivially_copyable<element_type>::value)
+		{
+			copy_groups(source);
+		}
+		else
+		{
+			tuple_allocator_pair.min_group_capacity = static_cast<capacity_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size)); // min group size is set to value closest to total number of elements in source hive in order to not create unnecessary small groups in the range-insert below, then reverts to the original min group size afterwards. This effectively saves a call to reserve.
+			range_assign(source.begin_iterator, source.total_size);
+			tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity; // reset to correct value for future operations
+		}
+	}
+
+
+
+	// Copy constructor (allocator-extended):
+
+	hive(const hive &source, const allocator_type &alloc):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	{
+		if constexpr (std::is_trivially_copyable<element_type>::value)
+		{
+			copy_groups(source);
+		}
+		else
+		{
+			tuple_allocator_pair.min_group_capacity = static_cast<capacity_type>((source.tuple_allocator_pair.min_group_capacity > source.total_size) ? source.tuple_allocator_pair.min_group_capacity : ((source.total_size > source.group_allocator_pair.max_group_capacity) ? source.group_allocator_pair.max_group_capacity : source.total_size));
+			range_assign(source.begin_iterator, source.total_size);
+			tuple_allocator_pair.min_group_capacity = source.tuple_allocator_pair.min_group_capacity;
+		}
+	}
+
+
+
+private:
+
+	inline void blank() noexcept
+	{
+		if constexpr (occupancy::trivial_pointers)	// if all pointer types are trivial, we can just nuke it from orbit with memset (NULL is always 0 in C++):
+		{
+			std::memset(static_cast<void *>(this), 0, offsetof(hive, tuple_allocator_pair));
+		}
+		else
+		{
+			end_iterator = begin_iterator = iterator();
+			groups_with_erasures_list_head = NULL;
+			unused_groups_head = NULL;
+			total_size = 0;
+			total_capacity = 0;
+		}
+	}
+
+public:
+
+
+
+	// Move constructor:
+
+	hive(hive &&source) noexcept:
+		occupancy(source),
+		end_iterator(std::move(source.end_iterator)),
+		begin_iterator(std::move(source.begin_iterator)),
+		groups_with_erasures_list_head(std::move(source.groups_with_erasures_list_head)),
+		unused_groups_head(std::move(source.unused_groups_head)),
+		total_size(source.total_size),
+		total_capacity(source.total_capacity),
+		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	{
+		assert(&source != this);
+		source.blank();
+		source.invalidate_group_index();
+	}
+
+
+
+	// Move constructor (allocator-extended):
+
+	hive(hive &&source, const allocator_type &alloc):
+		occupancy(alloc),
+		end_iterator(std::move(source.end_iterator)),
+		begin_iterator(std::move(source.begin_iterator)),
+		groups_with_erasures_list_head(std::move(source.groups_with_erasures_list_head)),
+		unused_groups_head(std::move(source.unused_groups_head)),
+		total_size(source.total_size),
+		total_capacity(source.total_capacity),
+		tuple_allocator_pair(source.tuple_allocator_pair.min_group_capacity),
+		group_allocator_pair(source.group_allocator_pair.max_group_capacity)
+	{
+		assert(&source != this);
+		source.blank();
+		source.invalidate_group_index();
+	}
+
+
+
+	// Fill constructor:
+
+	hive(const size_type fill_number, const element_type &element, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<capacity_type>::max()), const allocator_type &alloc = allocator_type()):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+		assign(fill_number, element);
+	}
+
+
+
+	// Default-value fill constructor:
+
+	explicit hive(const size_type fill_number, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<capacity_type>::max()), const allocator_type &alloc = allocator_type()):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+		assign(fill_number, element_type());
+	}
+
+
+
+	// Range constructor:
+
+	template<typename iterator_type>
+	hive(const typename std::enable_if_t<!std::numeric_limits<iterator_type>::is_integer, iterator_type> &first, const iterator_type &last, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<capacity_type>::max()), const allocator_type &alloc = allocator_type()):
+		occupancy(alloc),
+		groups_with_erasures_list_head(NULL),
+		unused_groups_head(NULL),
+		total_size(0),
+		total_capacity(0),
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+		assign<iterator_type>(first, last);
+	}
+
+
+
+	// Range constructor - sentinel support:
+
+	template <class iterator_type, class sentinel>
 		requires (!(std::convertible_to<sentinel, iterator_type> || std::convertible_to<iterator_type, sentinel> || std::integral<iterator_type> || std::integral<sentinel>) && std::sentinel_for<sentinel, iterator_type>)
-	hive(const iterator_type &first, const sentinel &last, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<skipfield_type>::max()), const allocator_type &alloc = allocator_type()):
-		allocator_type(alloc),
+	hive(const iterator_type &first, const sentinel &last, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<capacity_type>::max()), const allocator_type &alloc = allocator_type()):
+		occupancy(alloc),
 		groups_with_erasures_list_head(NULL),
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
 	{
 		check_capacities_conformance(capacities);
 		assign<iterator_type, sentinel>(first, last);
@@ -1613,14 +3546,14 @@ public:
 
 	// Initializer-list constructor:
 
-	hive(const std::initializer_list<element_type> &element_list, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<skipfield_type>::max()), const allocator_type &alloc = allocator_type()):
-		allocator_type(alloc),
+	hive(const std::initializer_list<element_type> &element_list, const plf::hive_limits capacities = plf::hive_limits(PLF_MIN_BLOCK_CAPACITY, std::numeric_limits<capacity_type>::max()), const allocator_type &alloc = allocator_type()):
+		occupancy(alloc),
 		groups_with_erasures_list_head(NULL),
 		unused_groups_head(NULL),
 		total_size(0),
 		total_capacity(0),
-		tuple_allocator_pair(static_cast<skipfield_type>(capacities.min)),
-		group_allocator_pair(static_cast<skipfield_type>(capacities.max))
+		tuple_allocator_pair(static_cast<capacity_type>(capacities.min)),
+		group_allocator_pair(static_cast<capacity_type>(capacities.max))
 	{
 		check_capacities_conformance(capacities);
 		range_assign(element_list.begin(), static_cast<size_type>(element_list.size()));
@@ -1672,28 +3605,28 @@ public:
 
 	inline reverse_iterator rbegin() noexcept
 	{
-		return (end_iterator.group_pointer != NULL) ? ++reverse_iterator(end_iterator) : reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (end_iterator.group_pointer != NULL) ? ++reverse_iterator(end_iterator) : reverse_iterator();
 	}
 
 
 
 	inline reverse_iterator rend() noexcept
 	{
-		return reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (begin_iterator.group_pointer != NULL) ? reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1) : reverse_iterator(); // The start of the group rather than begin() - 1, as begin() may not be the first element in the group if preceding elements have been erased, and reverse_iterator ++ always stops at the group start
 	}
 
 
 
 	inline const_reverse_iterator crbegin() const noexcept
 	{
-		return (end_iterator.group_pointer != NULL) ? ++const_reverse_iterator(end_iterator) : const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (end_iterator.group_pointer != NULL) ? ++const_reverse_iterator(end_iterator) : const_reverse_iterator();
 	}
 
 
 
 	inline const_reverse_iterator crend() const noexcept
 	{
-		return const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		return (begin_iterator.group_pointer != NULL) ? const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1) : const_reverse_iterator(); // The start of the group rather than begin() - 1, as begin() may not be the first element in the group if preceding elements have been erased, and reverse_iterator ++ always stops at the group start
 	}
 
 
@@ -1701,6 +3634,7 @@ public:
 	~hive() noexcept
 	{
 		destroy_all_data();
+		disable_group_index();
 	}
 
 
@@ -1708,13 +3642,13 @@ public:
 private:
 
 
-	group_pointer_type allocate_new_group(const skipfield_type elements_per_group, group_pointer_type const previous = NULL)
+	group_pointer_type allocate_new_group(const capacity_type elements_per_group, group_pointer_type const previous = NULL)
 	{
 		group_pointer_type const new_group = std::allocator_traits<group_allocator_type>::allocate(group_allocator_pair, 1, 0);
 
 		try
 		{
-			std::allocator_traits<group_allocator_type>::construct(group_allocator_pair, new_group, elements_per_group, previous);
+			std::allocator_traits<group_allocator_type>::construct(group_allocator_pair, new_group, elements_per_group, previous, (previous == NULL) ? 0 : previous->group_number + 1u);
 		}
 		catch (...)
 		{
@@ -1722,6 +3656,7 @@ private:
 			throw;
 		}
 
+		invalidate_group_index();
 		return new_group;
 	}
 
@@ -1731,6 +3666,17 @@ private:
 	{
 		std::allocator_traits<group_allocator_type>::destroy(group_allocator_pair, the_group);
 		std::allocator_traits<group_allocator_type>::deallocate(group_allocator_pair, the_group, 1);
+		invalidate_group_index();
+	}
+
+
+
+	inline void invalidate_group_index() noexcept
+	{
+		if (group_index.index != NULL)
+		{
+			group_index.index->stale = true;
+		}
 	}
 
 
@@ -1745,29 +3691,13 @@ private:
 			{
 				if (total_size != 0)
 				{
-					while (true) // Erase elements without bothering to update skipfield - much faster:
+					do // Erase elements without bothering to update occupancy - much faster:
 					{
-						const aligned_pointer_type end_pointer = begin_iterator.group_pointer->last_endpoint;
-
-						do
-						{
-							std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer));
-							begin_iterator.element_pointer += static_cast<size_type>(*++begin_iterator.skipfield_pointer) + 1u;
-							begin_iterator.skipfield_pointer += *begin_iterator.skipfield_pointer;
-						} while(begin_iterator.element_pointer != end_pointer); // ie. beyond end of available data
-
+						destroy_group_elements(begin_iterator.group_pointer);
 						const group_pointer_type next_group = begin_iterator.group_pointer->next_group;
 						deallocate_group(begin_iterator.group_pointer);
 						begin_iterator.group_pointer = next_group;
-
-						if (next_group == unused_groups_head)
-						{
-							break;
-						}
-
-						begin_iterator.element_pointer = next_group->elements + *(next_group->skipfield);
-						begin_iterator.skipfield_pointer = next_group->skipfield + *(next_group->skipfield);
-					}
+					} while (begin_iterator.group_pointer != unused_groups_head);
 				}
 			}
 
@@ -1782,59 +3712,52 @@ private:
 
 
 
-	void initialize(const skipfield_type first_group_size)
+	void initialize(const capacity_type first_group_size) // The new group is marked as holding one element, which the caller constructs at begin()
 	{
-		end_iterator.group_pointer = begin_iterator.group_pointer = allocate_new_group(first_group_size);
-		end_iterator.element_pointer = begin_iterator.element_pointer = begin_iterator.group_pointer->elements;
-		end_iterator.skipfield_pointer = begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield;
+		const group_pointer_type new_group = allocate_new_group(first_group_size);
+		begin_iterator = iterator(new_group, new_group->elements);
+		end_iterator = group_end(new_group);
 		total_capacity = first_group_size;
 	}
 
 
 
-	void update_skipblock(const iterator &new_location, const skipfield_type prev_free_list_index) noexcept
+	// Updates container state after construct_in_erased_location(), which always reuses a location in the first group in the groups-with-erasures list:
+	inline iterator erased_location_reused(const iterator &new_location) noexcept
 	{
-		const skipfield_type new_value = static_cast<skipfield_type>(*(new_location.skipfield_pointer) - 1);
-
-		if (new_value != 0) // ie. skipfield was not 1, ie. a single-node skipblock, with no additional nodes to update
-		{
-			// set (new) start and (original) end of skipblock to new value:
-			*(new_location.skipfield_pointer + new_value) = *(new_location.skipfield_pointer + 1) = new_value;
-
-			// transfer free list node to new start node:
-			++(groups_with_erasures_list_head->free_list_head);
-
-			if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the tail free list node
-			{
-				*(reinterpret_cast<skipfield_pointer_type>(new_location.group_pointer->elements + prev_free_list_index) + 1) = groups_with_erasures_list_head->free_list_head;
-			}
-
-			*(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer + 1)) = prev_free_list_index;
-			*(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer + 1) + 1) = std::numeric_limits<skipfield_type>::max();
-		}
-		else
+		if (!new_location.group_pointer->has_erasures()) // remove this group from the list of groups with erasures
 		{
-			groups_with_erasures_list_head->free_list_head = prev_free_list_index;
-
-			if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the last free list node
-			{
-				*(reinterpret_cast<skipfield_pointer_type>(new_location.group_pointer->elements + prev_free_list_index) + 1) = std::numeric_limits<skipfield_type>::max();
-			}
-			else // remove this group from the list of groups with erasures
-			{
-				groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
-			}
+			groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
 		}
 
-		*(new_location.skipfield_pointer) = 0;
-		++(new_location.group_pointer->size);
-
 		if (new_location.group_pointer == begin_iterator.group_pointer && new_location.element_pointer < begin_iterator.element_pointer)
 		{ /* ie. begin_iterator was moved forwards as the result of an erasure at some point, this erased element is before the current begin, hence, set current begin iterator to this element */
 			begin_iterator = new_location;
 		}
 
 		++total_size;
+		return new_location;
+	}
+
+
+
+	// As above, after fill_erased_locations() or range_fill_erased_locations() - including partial fills, when a construction has thrown. Returns the number of elements constructed:
+	size_type erased_locations_filled(const group_pointer_type the_group, const capacity_type previous_size) noexcept
+	{
+		const size_type number_filled = static_cast<size_type>(the_group->size - previous_size);
+		total_size += number_filled;
+
+		if (the_group == begin_iterator.group_pointer)
+		{
+			begin_iterator = group_begin(the_group);
+		}
+
+		if (!the_group->has_erasures())
+		{
+			groups_with_erasures_list_head = the_group->erasures_list_next_group;
+		}
+
+		return number_filled;
 	}
 
 
@@ -1856,23 +3779,11 @@ public:
 		{
 			if (groups_with_erasures_list_head == NULL) // ie. there are no erased elements and end_iterator is not at end of current final group
 			{
-				if (end_iterator.element_pointer != reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield))
+				if (end_iterator.element_pointer != end_iterator.group_pointer->end_of_elements())
 				{
 					const iterator return_iterator = end_iterator; /* Make copy for return before modifying end_iterator */
-
-					if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
-					{ // For no good reason this compiles to ridiculously faster code under GCC 5-9 in raw small struct tests with large N:
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), element);
-						end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-					}
-					else
-					{
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), element);
-						end_iterator.group_pointer->last_endpoint = ++end_iterator.element_pointer; // Shift the addition to the second operation, avoiding a try-catch block if an exception is thrown during construction
-					}
-
-					++(end_iterator.group_pointer->size);
-					++end_iterator.skipfield_pointer;
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), element);
+					mark_appended(end_iterator); // Shift the increment to after construction, avoiding a try-catch block if an exception is thrown
 					++total_size;
 
 					return return_iterator; // return value before incrementation
@@ -1882,7 +3793,7 @@ public:
 
 				if (unused_groups_head == NULL)
 				{
-					const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+					const capacity_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<capacity_type>(total_size) : group_allocator_pair.max_group_capacity;
 					next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
 					if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
@@ -1913,23 +3824,14 @@ public:
 				}
 
 				end_iterator.group_pointer->next_group = next_group;
-				end_iterator.group_pointer = next_group;
-				end_iterator.element_pointer = next_group->last_endpoint;
-				end_iterator.skipfield_pointer = next_group->skipfield + 1;
+				end_iterator = group_end(next_group);
 				++total_size;
 
-				return iterator(next_group, next_group->elements, next_group->skipfield); /* returns value before incrementation */
+				return iterator(next_group, next_group->elements); /* returns value before incrementation */
 			}
 			else // ie. there are erased elements, reuse previous-erased element locations
 			{
-				iterator new_location(groups_with_erasures_list_head, groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head, groups_with_erasures_list_head->skipfield + groups_with_erasures_list_head->free_list_head);
-
-				// We always reuse the element at the start of the skipblock, this is also where the free-list information for that skipblock is stored. Get the previous free-list node's index from this memory space, before we write to our element to it. 'Next' index is always the free_list_head (as represented by the maximum value of the skipfield type) here so we don't need to get it:
-				const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer));
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(new_location.element_pointer), element);
-				update_skipblock(new_location, prev_free_list_index);
-
-				return new_location;
+				return erased_location_reused(construct_in_erased_location(groups_with_erasures_list_head, element));
 			}
 		}
 		else // ie. newly-constructed hive, no insertions yet and no groups
@@ -1938,13 +3840,13 @@ public:
 
 			if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
 			{
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), element);
+				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), element);
 			}
 			else
 			{
 				try
 				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), element);
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), element);
 				}
 				catch (...)
 				{
@@ -1953,7 +3855,6 @@ public:
 				}
 			}
 
-			++end_iterator.skipfield_pointer;
 			total_size = 1;
 			return begin_iterator;
 		}
@@ -1967,23 +3868,11 @@ public:
 		{
 			if (groups_with_erasures_list_head == NULL)
 			{
-				if (end_iterator.element_pointer != reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield))
+				if (end_iterator.element_pointer != end_iterator.group_pointer->end_of_elements())
 				{
 					const iterator return_iterator = end_iterator;
-
-					if constexpr (std::is_nothrow_move_constructible<element_type>::value)
-					{
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::move(element));
-						end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-					}
-					else
-					{
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), std::move(element));
-						end_iterator.group_pointer->last_endpoint = ++end_iterator.element_pointer;
-					}
-
-					++(end_iterator.group_pointer->size);
-					++end_iterator.skipfield_pointer;
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), std::move(element));
+					mark_appended(end_iterator);
 					++total_size;
 
 					return return_iterator;
@@ -1993,7 +3882,7 @@ public:
 
 				if (unused_groups_head == NULL)
 				{
-					const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+					const capacity_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<capacity_type>(total_size) : group_allocator_pair.max_group_capacity;
 					next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
 					if constexpr (std::is_nothrow_move_constructible<element_type>::value)
@@ -2024,22 +3913,14 @@ public:
 				}
 
 				end_iterator.group_pointer->next_group = next_group;
-				end_iterator.group_pointer = next_group;
-				end_iterator.element_pointer = next_group->last_endpoint;
-				end_iterator.skipfield_pointer = next_group->skipfield + 1;
+				end_iterator = group_end(next_group);
 				++total_size;
 
-				return iterator(next_group, next_group->elements, next_group->skipfield); /* returns value before incrementation */
+				return iterator(next_group, next_group->elements);
 			}
 			else
 			{
-				iterator new_location(groups_with_erasures_list_head, groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head, groups_with_erasures_list_head->skipfield + groups_with_erasures_list_head->free_list_head);
-
-				const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer));
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(new_location.element_pointer), std::move(element));
-				update_skipblock(new_location, prev_free_list_index);
-
-				return new_location;
+				return erased_location_reused(construct_in_erased_location(groups_with_erasures_list_head, std::move(element)));
 			}
 		}
 		else
@@ -2048,13 +3929,13 @@ public:
 
 			if constexpr (std::is_nothrow_move_constructible<element_type>::value)
 			{
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::move(element));
+				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), std::move(element));
 			}
 			else
 			{
 				try
 				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::move(element));
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), std::move(element));
 				}
 				catch (...)
 				{
@@ -2063,7 +3944,6 @@ public:
 				}
 			}
 
-			++end_iterator.skipfield_pointer;
 			total_size = 1;
 			return begin_iterator;
 		}
@@ -2078,23 +3958,11 @@ public:
 		{
 			if (groups_with_erasures_list_head == NULL)
 			{
-				if (end_iterator.element_pointer != reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield))
+				if (end_iterator.element_pointer != end_iterator.group_pointer->end_of_elements())
 				{
 					const iterator return_iterator = end_iterator;
-
-					if constexpr (std::is_nothrow_constructible<element_type>::value)
-					{
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::forward<arguments>(parameters) ...);
-						end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-					}
-					else
-					{
-						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), std::forward<arguments>(parameters) ...);
-						end_iterator.group_pointer->last_endpoint = ++end_iterator.element_pointer;
-					}
-
-					++(end_iterator.group_pointer->size);
-					++end_iterator.skipfield_pointer;
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), std::forward<arguments>(parameters) ...);
+					mark_appended(end_iterator);
 					++total_size;
 
 					return return_iterator;
@@ -2104,10 +3972,10 @@ public:
 
 				if (unused_groups_head == NULL)
 				{
-					const skipfield_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<skipfield_type>(total_size) : group_allocator_pair.max_group_capacity;
+					const capacity_type new_group_size = (total_size < static_cast<size_type>(group_allocator_pair.max_group_capacity)) ? static_cast<capacity_type>(total_size) : group_allocator_pair.max_group_capacity;
 					next_group = allocate_new_group(new_group_size, end_iterator.group_pointer);
 
-					if constexpr (std::is_nothrow_constructible<element_type>::value)
+					if constexpr (std::is_nothrow_constructible<element_type, arguments ...>::value)
 					{
 						std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(next_group->elements), std::forward<arguments>(parameters) ...);
 					}
@@ -2135,22 +4003,14 @@ public:
 				}
 
 				end_iterator.group_pointer->next_group = next_group;
-				end_iterator.group_pointer = next_group;
-				end_iterator.element_pointer = next_group->last_endpoint;
-				end_iterator.skipfield_pointer = next_group->skipfield + 1;
+				end_iterator = group_end(next_group);
 				++total_size;
 
-				return iterator(next_group, next_group->elements, next_group->skipfield); /* returns value before incrementation */
+				return iterator(next_group, next_group->elements);
 			}
 			else
 			{
-				iterator new_location(groups_with_erasures_list_head, groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head, groups_with_erasures_list_head->skipfield + groups_with_erasures_list_head->free_list_head);
-
-				const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(new_location.element_pointer));
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(new_location.element_pointer), std::forward<arguments>(parameters) ...);
-				update_skipblock(new_location, prev_free_list_index);
-
-				return new_location;
+				return erased_location_reused(construct_in_erased_location(groups_with_erasures_list_head, std::forward<arguments>(parameters) ...));
 			}
 		}
 		else
@@ -2159,13 +4019,13 @@ public:
 
 			if constexpr (std::is_nothrow_constructible<element_type, arguments ...>::value)
 			{
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::forward<arguments>(parameters) ...);
+				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), std::forward<arguments>(parameters) ...);
 			}
 			else
 			{
 				try
 				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer++), std::forward<arguments>(parameters) ...);
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(begin_iterator.element_pointer), std::forward<arguments>(parameters) ...);
 				}
 				catch (...)
 				{
@@ -2174,7 +4034,6 @@ public:
 				}
 			}
 
-			++end_iterator.skipfield_pointer;
 			total_size = 1;
 			return begin_iterator;
 		}
@@ -2186,23 +4045,35 @@ public:
 private:
 
 	// For catch blocks in fill() and range_fill()
-	void recover_from_partial_fill()
+	void recover_from_partial_fill(const aligned_pointer_type fill_start)
 	{
 		if constexpr (!std::is_nothrow_copy_constructible<element_type>::value)
 		{
-			end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-			const skipfield_type elements_constructed_before_exception = static_cast<skipfield_type>(end_iterator.element_pointer - end_iterator.group_pointer->elements);
-			end_iterator.group_pointer->size = elements_constructed_before_exception;
-			end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + elements_constructed_before_exception;
-			total_size += elements_constructed_before_exception;
-			unused_groups_head = end_iterator.group_pointer->next_group;
-			end_iterator.group_pointer->next_group = NULL;
+			const group_pointer_type current_group = end_iterator.group_pointer;
+			total_size += static_cast<size_type>(end_iterator.element_pointer - fill_start);
+
+			if (current_group->next_group != NULL) // ie. an unused group which was linked to the remaining unused groups in fill_unused_groups - not the back group's remainder, or the final (partially-filled) group, whose next_group is already NULL
+			{
+				unused_groups_head = current_group->next_group;
+				current_group->next_group = NULL;
+			}
+
+			if (end_iterator.element_pointer == current_group->elements && current_group->previous_group != NULL) // Nothing constructed in this group - return it to the unused groups. Preceding groups are full at this point
+			{
+				end_iterator = group_end(current_group->previous_group);
+				end_iterator.group_pointer->next_group = NULL;
+				add_group_to_unused_groups_list(current_group);
+			}
+			else
+			{
+				mark_filled(end_iterator); // Back group has no erasures during a fill
+			}
 		}
 	}
 
 
 
-	void fill(const element_type &element, const skipfield_type size)
+	void fill(const element_type &element, const capacity_type size)
 	{
 		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
 		{
@@ -2242,91 +4113,13 @@ private:
 				}
 				catch (...)
 				{
-					recover_from_partial_fill();
+					recover_from_partial_fill(fill_end - size);
 					throw;
 				}
 			} while (++end_iterator.element_pointer != fill_end);
 		}
 
-		total_size += size;
-	}
-
-
-
-	// For catch blocks in range_fill_skipblock and fill_skipblock
-	void recover_from_partial_skipblock_fill(aligned_pointer_type const location, const aligned_pointer_type current_location, skipfield_pointer_type const skipfield_pointer, const skipfield_type prev_free_list_node)
-	{
-		if constexpr (!std::is_nothrow_copy_constructible<element_type>::value)
-		{
-			// Reconstruct existing skipblock and free-list indexes to reflect partially-reused skipblock:
-			const skipfield_type elements_constructed_before_exception = static_cast<skipfield_type>((current_location - 1) - location);
-			groups_with_erasures_list_head->size = static_cast<skipfield_type>(groups_with_erasures_list_head->size + elements_constructed_before_exception);
-			total_size += elements_constructed_before_exception;
-
-			std::memset(skipfield_pointer, 0, elements_constructed_before_exception * sizeof(skipfield_type));
-
-			*(reinterpret_cast<skipfield_pointer_type>(location + elements_constructed_before_exception)) = prev_free_list_node;
-			*(reinterpret_cast<skipfield_pointer_type>(location + elements_constructed_before_exception) + 1) = std::numeric_limits<skipfield_type>::max();
-
-			const skipfield_type new_skipblock_head_index = static_cast<skipfield_type>((location - groups_with_erasures_list_head->elements) + elements_constructed_before_exception);
-			groups_with_erasures_list_head->free_list_head = new_skipblock_head_index;
-
-			if (prev_free_list_node != std::numeric_limits<skipfield_type>::max())
-			{
-				*(reinterpret_cast<skipfield_pointer_type>(groups_with_erasures_list_head->elements + prev_free_list_node) + 1) = new_skipblock_head_index;
-			}
-		}
-	}
-
-
-
-	void fill_skipblock(const element_type &element, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
-	{
-		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
-		{
-			if constexpr (std::is_trivially_copyable<element_type>::value && std::is_trivially_copy_constructible<element_type>::value)
-			{
-				if constexpr (sizeof(aligned_element_type) != sizeof(element_type))
-				{
-					alignas (alignof(aligned_element_type)) element_type aligned_copy = element;
-					std::fill_n(location, size, *(reinterpret_cast<aligned_pointer_type>(&aligned_copy)));
-				}
-				else
-				{
-					std::fill_n(reinterpret_cast<pointer>(location), size, element);
-				}
-			}
-			else
-			{
-				const aligned_pointer_type fill_end = location + size;
-
-				for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
-				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), element);
-				}
-			}
-		}
-		else
-		{
-			const aligned_pointer_type fill_end = location + size;
-			const skipfield_type prev_free_list_node = *(reinterpret_cast<skipfield_pointer_type>(location)); // in case of exception, grabbing indexes before free_list node is reused
-
-			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
-			{
-				try
-				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), element);
-				}
-				catch (...)
-				{
-					recover_from_partial_skipblock_fill(location, current_location, skipfield_pointer, prev_free_list_node);
-					throw;
-				}
-			}
-		}
-
-		std::memset(skipfield_pointer, 0, size * sizeof(skipfield_type)); // reset skipfield nodes within skipblock to 0
-		groups_with_erasures_list_head->size = static_cast<skipfield_type>(groups_with_erasures_list_head->size + size);
+		mark_filled(end_iterator);
 		total_size += size;
 	}
 
@@ -2338,8 +4131,8 @@ private:
 
 		for (; end_iterator.group_pointer->capacity < size; end_iterator.group_pointer = end_iterator.group_pointer->next_group)
 		{
-			const skipfield_type capacity = end_iterator.group_pointer->capacity;
-			end_iterator.group_pointer->reset(capacity, end_iterator.group_pointer->next_group, previous_group, group_number++);
+			const capacity_type capacity = end_iterator.group_pointer->capacity;
+			end_iterator.group_pointer->reset(0, end_iterator.group_pointer->next_group, previous_group, group_number++);
 			previous_group = end_iterator.group_pointer;
 			size -= static_cast<size_type>(capacity);
 			end_iterator.element_pointer = end_iterator.group_pointer->elements;
@@ -2348,10 +4141,9 @@ private:
 
 		// Deal with final group (partial fill)
 		unused_groups_head = end_iterator.group_pointer->next_group;
-		end_iterator.group_pointer->reset(static_cast<skipfield_type>(size), NULL, previous_group, group_number);
+		end_iterator.group_pointer->reset(0, NULL, previous_group, group_number);
 		end_iterator.element_pointer = end_iterator.group_pointer->elements;
-		end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + size;
-		fill(element, static_cast<skipfield_type>(size));
+		fill(element, static_cast<capacity_type>(size));
 	}
 
 
@@ -2381,58 +4173,23 @@ public:
 		reserve(total_size + size);
 
 		// Use up erased locations if available:
-		while(groups_with_erasures_list_head != NULL) // skipblock loop: breaks when hive is exhausted of reusable skipblocks, or returns if size == 0
+		while(groups_with_erasures_list_head != NULL) // group loop: breaks when hive is exhausted of reusable locations, or returns if size == 0
 		{
-			aligned_pointer_type const element_pointer = groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head;
-			skipfield_pointer_type const skipfield_pointer = groups_with_erasures_list_head->skipfield + groups_with_erasures_list_head->free_list_head;
-			const skipfield_type skipblock_size = *skipfield_pointer;
+			const group_pointer_type the_group = groups_with_erasures_list_head;
+			const capacity_type previous_size = the_group->size;
 
-			if (groups_with_erasures_list_head == begin_iterator.group_pointer && element_pointer < begin_iterator.element_pointer)
+			try
 			{
-				begin_iterator.element_pointer = element_pointer;
-				begin_iterator.skipfield_pointer = skipfield_pointer;
+				fill_erased_locations(the_group, size, element);
 			}
-
-			if (skipblock_size <= size)
+			catch (...)
 			{
-				groups_with_erasures_list_head->free_list_head = *(reinterpret_cast<skipfield_pointer_type>(element_pointer)); // set free list head to previous free list node
-				fill_skipblock(element, element_pointer, skipfield_pointer, skipblock_size);
-				size -= skipblock_size;
-
-				if (groups_with_erasures_list_head->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. there are more skipblocks to be filled in this group
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head) + 1) = std::numeric_limits<skipfield_type>::max(); // set 'next' index of new free list head to 'end' (numeric max)
-				}
-				else
-				{
-					groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group; // change groups
-				}
-
-				if (size == 0)
-				{
-					return;
-				}
+				erased_locations_filled(the_group, previous_size);
+				throw;
 			}
-			else // skipblock is larger than remaining number of elements
-			{
-				const skipfield_type prev_index = *(reinterpret_cast<skipfield_pointer_type>(element_pointer)); // save before element location is overwritten
-				fill_skipblock(element, element_pointer, skipfield_pointer, static_cast<skipfield_type>(size));
-				const skipfield_type new_skipblock_size = static_cast<skipfield_type>(skipblock_size - size);
-
-				// Update skipfield (earlier nodes already memset'd in fill_skipblock function):
-				*(skipfield_pointer + size) = new_skipblock_size;
-				*(skipfield_pointer + skipblock_size - 1) = new_skipblock_size;
-				groups_with_erasures_list_head->free_list_head = static_cast<skipfield_type>(groups_with_erasures_list_head->free_list_head + size); // set free list head to new start node
-
-				// Update free list with new head:
-				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size)) = prev_index;
-				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size) + 1) = std::numeric_limits<skipfield_type>::max();
-
-				if (prev_index != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(groups_with_erasures_list_head->elements + prev_index) + 1) = groups_with_erasures_list_head->free_list_head; // set 'next' index of previous skipblock to new start of skipblock
-				}
 
+			if ((size -= erased_locations_filled(the_group, previous_size)) == 0)
+			{
 				return;
 			}
 		}
@@ -2440,20 +4197,17 @@ public:
 
 		// Use up remaining available element locations in end group:
 		// This variable is either the remaining capacity of the group or the number of elements yet to be filled, whichever is smaller:
-		const skipfield_type group_remainder = (static_cast<skipfield_type>(
-			reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) >= size) ?
-			static_cast<skipfield_type>(size) :
-			static_cast<skipfield_type>(reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer);
+		const capacity_type group_remainder = (static_cast<capacity_type>(
+			end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer) >= size) ?
+			static_cast<capacity_type>(size) :
+			static_cast<capacity_type>(end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer);
 
 		if (group_remainder != 0)
 		{
 			fill(element, group_remainder);
-			end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-			end_iterator.group_pointer->size = static_cast<skipfield_type>(end_iterator.group_pointer->size + group_remainder);
 
 			if (size == group_remainder) // Ie. remaining capacity was >= remaining elements to be filled
 			{
-				end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + end_iterator.group_pointer->size;
 				return;
 			}
 
@@ -2471,7 +4225,7 @@ public:
 private:
 
 	template <class iterator_type>
-	iterator_type range_fill(iterator_type it, const skipfield_type size)
+	iterator_type range_fill(iterator_type it, const capacity_type size)
 	{
 		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
 		{
@@ -2480,66 +4234,28 @@ private:
 			do
 			{
 				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), *it++);
-			} while (++end_iterator.element_pointer != fill_end);
-		}
-		else
-		{
-			const aligned_pointer_type fill_end = end_iterator.element_pointer + size;
-
-			do
-			{
-				try
-				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), *it++);
-				}
-				catch (...)
-				{
-					recover_from_partial_fill();
-					throw;
-				}
-			} while (++end_iterator.element_pointer != fill_end);
-		}
-
-		total_size += size;
-		return it;
-	}
-
-
-
-	template <class iterator_type>
-	iterator_type range_fill_skipblock(iterator_type it, aligned_pointer_type const location, skipfield_pointer_type const skipfield_pointer, const skipfield_type size)
-	{
-		const aligned_pointer_type fill_end = location + size;
-
-		if constexpr (std::is_nothrow_copy_constructible<element_type>::value)
-		{
-			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
-			{
-				std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), *it++);
-			}
+			} while (++end_iterator.element_pointer != fill_end);
 		}
 		else
 		{
-			const skipfield_type prev_free_list_node = *(reinterpret_cast<skipfield_pointer_type>(location)); // in case of exception, grabbing indexes before free_list node is reused
+			const aligned_pointer_type fill_end = end_iterator.element_pointer + size;
 
-			for (aligned_pointer_type current_location = location; current_location != fill_end; ++current_location)
+			do
 			{
 				try
 				{
-					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(current_location), *it++);
+					std::allocator_traits<allocator_type>::construct(*this, reinterpret_cast<pointer>(end_iterator.element_pointer), *it++);
 				}
 				catch (...)
 				{
-					recover_from_partial_skipblock_fill(location, current_location, skipfield_pointer, prev_free_list_node);
+					recover_from_partial_fill(fill_end - size);
 					throw;
 				}
-			}
+			} while (++end_iterator.element_pointer != fill_end);
 		}
 
-		std::memset(skipfield_pointer, 0, size * sizeof(skipfield_type)); // reset skipfield nodes within skipblock to 0
-		groups_with_erasures_list_head->size = static_cast<skipfield_type>(groups_with_erasures_list_head->size + size);
+		mark_filled(end_iterator);
 		total_size += size;
-
 		return it;
 	}
 
@@ -2552,8 +4268,8 @@ private:
 
 		for (; end_iterator.group_pointer->capacity < size; end_iterator.group_pointer = end_iterator.group_pointer->next_group)
 		{
-			const skipfield_type capacity = end_iterator.group_pointer->capacity;
-			end_iterator.group_pointer->reset(capacity, end_iterator.group_pointer->next_group, previous_group, group_number++);
+			const capacity_type capacity = end_iterator.group_pointer->capacity;
+			end_iterator.group_pointer->reset(0, end_iterator.group_pointer->next_group, previous_group, group_number++);
 			previous_group = end_iterator.group_pointer;
 			size -= static_cast<size_type>(capacity);
 			end_iterator.element_pointer = end_iterator.group_pointer->elements;
@@ -2562,10 +4278,9 @@ private:
 
 		// Deal with final group (partial fill)
 		unused_groups_head = end_iterator.group_pointer->next_group;
-		end_iterator.group_pointer->reset(static_cast<skipfield_type>(size), NULL, previous_group, group_number);
+		end_iterator.group_pointer->reset(0, NULL, previous_group, group_number);
 		end_iterator.element_pointer = end_iterator.group_pointer->elements;
-		end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + size;
-		range_fill(it, static_cast<skipfield_type>(size));
+		range_fill(it, static_cast<capacity_type>(size));
 	}
 
 
@@ -2594,73 +4309,37 @@ private:
 
 		while(groups_with_erasures_list_head != NULL)
 		{
-			aligned_pointer_type const element_pointer = groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head;
-			skipfield_pointer_type const skipfield_pointer = groups_with_erasures_list_head->skipfield + groups_with_erasures_list_head->free_list_head;
-			const skipfield_type skipblock_size = *skipfield_pointer;
+			const group_pointer_type the_group = groups_with_erasures_list_head;
+			const capacity_type previous_size = the_group->size;
 
-			if (groups_with_erasures_list_head == begin_iterator.group_pointer && element_pointer < begin_iterator.element_pointer)
+			try
 			{
-				begin_iterator.element_pointer = element_pointer;
-				begin_iterator.skipfield_pointer = skipfield_pointer;
+				it = range_fill_erased_locations(the_group, size, it);
 			}
-
-			if (skipblock_size <= size)
+			catch (...)
 			{
-				groups_with_erasures_list_head->free_list_head = *(reinterpret_cast<skipfield_pointer_type>(element_pointer));
-				it = range_fill_skipblock(it, element_pointer, skipfield_pointer, skipblock_size);
-				size -= skipblock_size;
-
-				if (groups_with_erasures_list_head->free_list_head != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(groups_with_erasures_list_head->elements + groups_with_erasures_list_head->free_list_head) + 1) = std::numeric_limits<skipfield_type>::max();
-				}
-				else
-				{
-					groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
-				}
-
-				if (size == 0)
-				{
-					return;
-				}
+				erased_locations_filled(the_group, previous_size);
+				throw;
 			}
-			else
-			{
-				const skipfield_type prev_index = *(reinterpret_cast<skipfield_pointer_type>(element_pointer));
-				it = range_fill_skipblock(it, element_pointer, skipfield_pointer, static_cast<skipfield_type>(size));
-				const skipfield_type new_skipblock_size = static_cast<skipfield_type>(skipblock_size - size);
-
-				*(skipfield_pointer + size) = new_skipblock_size;
-				*(skipfield_pointer + skipblock_size - 1) = new_skipblock_size;
-				groups_with_erasures_list_head->free_list_head = static_cast<skipfield_type>(groups_with_erasures_list_head->free_list_head + size);
-
-				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size)) = prev_index;
-				*(reinterpret_cast<skipfield_pointer_type>(element_pointer + size) + 1) = std::numeric_limits<skipfield_type>::max();
-
-				if (prev_index != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(groups_with_erasures_list_head->elements + prev_index) + 1) = groups_with_erasures_list_head->free_list_head;
-				}
 
+			if ((size -= erased_locations_filled(the_group, previous_size)) == 0)
+			{
 				return;
 			}
 		}
 
 
-		const skipfield_type group_remainder = (static_cast<skipfield_type>(
-			reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) >= size) ?
-			static_cast<skipfield_type>(size) :
-			static_cast<skipfield_type>(reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer);
+		const capacity_type group_remainder = (static_cast<capacity_type>(
+			end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer) >= size) ?
+			static_cast<capacity_type>(size) :
+			static_cast<capacity_type>(end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer);
 
 		if (group_remainder != 0)
 		{
 			it = range_fill(it, group_remainder);
-			end_iterator.group_pointer->last_endpoint = end_iterator.element_pointer;
-			end_iterator.group_pointer->size = static_cast<skipfield_type>(end_iterator.group_pointer->size + group_remainder);
 
 			if (size == group_remainder)
 			{
-				end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + end_iterator.group_pointer->size;
 				return;
 			}
 
@@ -2720,8 +4399,242 @@ public:
 
 
 
+	#ifdef PLF_EXECUTION_POLICY_SUPPORT
+		// Fill insert with an execution policy (eg. std::execution::par) - see parallel_insert() below:
+		template <class execution_policy>
+		void insert(execution_policy &&policy, const size_type size, const element_type &element)
+		{
+			parallel_insert(std::forward<execution_policy>(policy), size,
+				[this, &element] (const pointer location, const size_type)
+				{
+					std::allocator_traits<allocator_type>::construct(*this, location, element);
+				},
+				[this, &element] (const size_type number_of_elements)
+				{
+					if (total_size != 0)
+					{
+						insert(number_of_elements, element);
+					}
+					else // Single insertions into the empty back group, as assign() would reorganise the unused groups already constructed into
+					{
+						for (size_type counter = 0; counter != number_of_elements; ++counter)
+						{
+							insert(element);
+						}
+					}
+				});
+		}
+
+
+
+		// Range insert with an execution policy. Random-access iterators are required so that each task can locate its part of the range directly:
+		template <class execution_policy, class iterator_type>
+			requires std::random_access_iterator<iterator_type>
+		void insert(execution_policy &&policy, const iterator_type first, const iterator_type last)
+		{
+			parallel_insert(std::forward<execution_policy>(policy), static_cast<size_type>(last - first),
+				[this, &first] (const pointer location, const size_type index)
+				{
+					std::allocator_traits<allocator_type>::construct(*this, location, first[static_cast<std::iter_difference_t<iterator_type>>(index)]);
+				},
+				[this, &first] (const size_type number_of_elements)
+				{
+					if (total_size != 0)
+					{
+						range_insert(first, number_of_elements);
+					}
+					else
+					{
+						iterator_type current = first;
+
+						for (size_type counter = 0; counter != number_of_elements; ++counter, ++current)
+						{
+							insert(*current);
+						}
+					}
+				});
+		}
+	#endif
+
+
+
 private:
 
+	#ifdef PLF_EXECUTION_POLICY_SUPPORT
+		struct parallel_insert_task
+		{
+			group_pointer_type group_pointer;
+			size_type first_index; // Index of the group's first element within the inserted range
+			capacity_type number_of_elements;
+			bool constructed;
+
+			parallel_insert_task(const group_pointer_type _group, const size_type _index, const capacity_type _number) noexcept:
+				group_pointer(_group),
+				first_index(_index),
+				number_of_elements(_number),
+				constructed(false)
+			{}
+		};
+
+
+
+		static void destroy_parallel_insert_task(allocator_type &allocator, const parallel_insert_task &task, const capacity_type number_of_elements) noexcept
+		{
+			if constexpr (!std::is_trivially_destructible<element_type>::value)
+			{
+				for (aligned_pointer_type current = task.group_pointer->elements, end = current + number_of_elements; current != end; ++current)
+				{
+					std::allocator_traits<allocator_type>::destroy(allocator, reinterpret_cast<pointer>(current));
+				}
+			}
+		}
+
+
+
+		// Inserts the first in-place elements (erased locations + the back group's remaining capacity) serially via serial_insert(number_of_elements), as reusing erased locations updates the shared free lists. The remainder are constructed into unused groups via construct_element(location, index), where index is the element's position within the inserted range - in parallel, one task per group. The groups are only linked into the chain once all elements have been constructed, so if any construction throws, the elements constructed in parallel are destroyed, the groups remain unused and the exception is rethrown:
+		template <class execution_policy, class construct_function, class serial_function>
+		void parallel_insert(execution_policy &&policy, const size_type size, const construct_function &construct_element, const serial_function &serial_insert)
+		{
+			if (size == 0)
+			{
+				return;
+			}
+
+			if (begin_iterator.group_pointer == NULL)
+			{
+				reserve(size);
+			}
+
+			size_type in_place = 0;
+
+			for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+			{
+				in_place += static_cast<size_type>(current_group->last_endpoint - current_group->elements);
+			}
+
+			in_place = (in_place - total_size) + static_cast<size_type>(end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer);
+
+			if (size <= in_place)
+			{
+				serial_insert(size);
+				return;
+			}
+
+			const size_type parallel_size = size - in_place;
+			size_type unused_capacity = 0;
+
+			for (group_pointer_type current_group = unused_groups_head; current_group != NULL; current_group = current_group->next_group)
+			{
+				unused_capacity += current_group->capacity;
+			}
+
+			if (unused_capacity < parallel_size)
+			{
+				reserve(total_capacity + (parallel_size - unused_capacity));
+			}
+
+			// Allocate one task per unused group needed:
+			size_type number_of_tasks = 0;
+			group_pointer_type current_group = unused_groups_head;
+
+			for (size_type remaining = parallel_size; remaining != 0; current_group = current_group->next_group, ++number_of_tasks)
+			{
+				remaining -= (current_group->capacity < remaining) ? current_group->capacity : remaining;
+			}
+
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<parallel_insert_task> task_allocator_type;
+			typedef typename std::allocator_traits<task_allocator_type>::pointer task_pointer_type;
+
+			task_allocator_type task_allocator(*this);
+			const task_pointer_type tasks = std::allocator_traits<task_allocator_type>::allocate(task_allocator, number_of_tasks);
+			parallel_insert_task * const tasks_begin = &*tasks, * const tasks_end = tasks_begin + number_of_tasks;
+			size_type index = in_place;
+			current_group = unused_groups_head;
+
+			for (parallel_insert_task *task = tasks_begin; task != tasks_end; ++task, current_group = current_group->next_group)
+			{
+				const capacity_type number_of_elements = (current_group->capacity < size - index) ? current_group->capacity : static_cast<capacity_type>(size - index);
+				std::allocator_traits<task_allocator_type>::construct(task_allocator, task, current_group, index, number_of_elements);
+				index += number_of_elements;
+			}
+
+
+			// Construct in parallel, then insert the in-place elements:
+			std::atomic<bool> failed(false);
+			std::exception_ptr exception;
+
+			try
+			{
+				std::for_each(std::forward<execution_policy>(policy), tasks_begin, tasks_end, [this, &construct_element, &failed, &exception](parallel_insert_task &task)
+				{
+					capacity_type number_constructed = 0;
+
+					try
+					{
+						for (aligned_pointer_type location = task.group_pointer->elements; number_constructed != task.number_of_elements; ++location, ++number_constructed)
+						{
+							construct_element(reinterpret_cast<pointer>(location), task.first_index + number_constructed);
+						}
+
+						task.constructed = true;
+					}
+					catch (...)
+					{
+						destroy_parallel_insert_task(*this, task, number_constructed);
+
+						if (!failed.exchange(true))
+						{
+							exception = std::current_exception();
+						}
+					}
+				});
+
+				if (!failed)
+				{
+					serial_insert(in_place);
+				}
+			}
+			catch (...) // std::bad_alloc from the execution policy, or an exception from the serial insert
+			{
+				if (!failed.exchange(true))
+				{
+					exception = std::current_exception();
+				}
+			}
+
+			if (failed)
+			{
+				for (parallel_insert_task *task = tasks_begin; task != tasks_end; ++task)
+				{
+					if (task->constructed)
+					{
+						destroy_parallel_insert_task(*this, *task, task->number_of_elements);
+					}
+				}
+
+				std::allocator_traits<task_allocator_type>::deallocate(task_allocator, tasks, number_of_tasks);
+				std::rethrow_exception(exception);
+			}
+
+
+			// Link the constructed groups to the back of the chain:
+			unused_groups_head = (tasks_end - 1)->group_pointer->next_group;
+
+			for (parallel_insert_task *task = tasks_begin; task != tasks_end; ++task)
+			{
+				task->group_pointer->reset(task->number_of_elements, NULL, end_iterator.group_pointer, end_iterator.group_pointer->group_number + 1u);
+				end_iterator.group_pointer->next_group = task->group_pointer;
+				end_iterator.group_pointer = task->group_pointer;
+			}
+
+			end_iterator = group_end(end_iterator.group_pointer);
+			total_size += parallel_size;
+
+			std::allocator_traits<task_allocator_type>::deallocate(task_allocator, tasks, number_of_tasks);
+			invalidate_group_index();
+		}
+	#endif
+
 	inline void update_subsequent_group_numbers(group_pointer_type current_group) noexcept
 	{
 		do
@@ -2733,6 +4646,22 @@ private:
 
 
 
+	// Used by splice() to decide whether swapping with the source is worthwhile: after a swap the destination's groups end up at the back of the chain and must be renumbered, so only swap if there are no more of them than the source's. Walks both chains together, so the cost is proportional to the smaller number of groups:
+	bool has_no_more_groups_than(const hive &source) const noexcept
+	{
+		group_pointer_type current_group = begin_iterator.group_pointer, source_group = source.begin_iterator.group_pointer;
+
+		while (current_group != NULL && source_group != NULL)
+		{
+			current_group = current_group->next_group;
+			source_group = source_group->next_group;
+		}
+
+		return current_group == NULL;
+	}
+
+
+
 	void remove_from_groups_with_erasures_list(const group_pointer_type group_to_remove) noexcept
 	{
 		if (group_to_remove == groups_with_erasures_list_head)
@@ -2760,8 +4689,7 @@ private:
 		group_pointer->reset(0, NULL, NULL, 0);
 
 		// Reset begin and end iterators:
-		end_iterator.element_pointer = begin_iterator.element_pointer = group_pointer->last_endpoint;
-		end_iterator.skipfield_pointer = begin_iterator.skipfield_pointer = group_pointer->skipfield;
+		end_iterator = begin_iterator = group_end(group_pointer);
 	}
 
 
@@ -2782,7 +4710,7 @@ public:
 		assert(total_size != 0);
 		assert(it.group_pointer != NULL); // ie. not uninitialized iterator
 		assert(it.element_pointer != it.group_pointer->last_endpoint); // ie. != end()
-		assert(*(it.skipfield_pointer) == 0); // ie. element pointed to by iterator has not been erased previously
+		assert(is_element(it.group_pointer, it.element_pointer)); // ie. element pointed to by iterator has not been erased previously
 
 		if constexpr (!std::is_trivially_destructible<element_type>::value) // This if-statement should be removed by the compiler on resolution of element_type. For some optimizing compilers this step won't be necessary (for MSVC 2013 it makes a difference)
 		{
@@ -2791,113 +4719,16 @@ public:
 
 		--total_size;
 
-		if (it.group_pointer->size-- != 1) // ie. non-empty group at this point in time, don't consolidate - optimization note: GCC optimizes postfix - 1 comparison better than prefix - 1 comparison in some cases.
+		if (it.group_pointer->size != 1) // ie. non-empty group at this point in time, don't consolidate
 		{
-			// Code logic for following section:
-			// ---------------------------------
-			// If current skipfield node has no skipblock on either side, create new skipblock of size 1
-			// If node only has skipblock on left, set current node and start node of the skipblock to left node value + 1.
-			// If node only has skipblock on right, make this node the start node of the skipblock and update end node
-			// If node has skipblocks on left and right, set start node of left skipblock and end node of right skipblock to the values of the left + right nodes + 1
-
-			// Optimization explanation:
-			// The contextual logic below is the same as that in the insert() functions but in this case the value of the current skipfield node will always be
-			// zero (since it is not yet erased), meaning no additional manipulations are necessary for the previous skipfield node comparison - we only have to check against zero
-			const char prev_skipfield = *(it.skipfield_pointer - (it.skipfield_pointer != it.group_pointer->skipfield)) != 0;
-			const char after_skipfield = *(it.skipfield_pointer + 1) != 0;  // NOTE: boundary test (checking against end-of-elements) is able to be skipped due to the extra skipfield node (compared to element field) - which is present to enable faster iterator operator ++ operations
-			skipfield_type update_value = 1;
-
-			if (!(prev_skipfield | after_skipfield)) // no consecutive erased elements
-			{
-				*it.skipfield_pointer = 1; // solo skipped node
-				const skipfield_type index = static_cast<skipfield_type>(it.element_pointer - it.group_pointer->elements);
-
-				if (it.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + it.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
-				}
-				else
-				{
-					it.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
-					groups_with_erasures_list_head = it.group_pointer;
-				}
-
-				*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer)) = it.group_pointer->free_list_head;
-				*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
-				it.group_pointer->free_list_head = index;
-			}
-			else if (prev_skipfield & (!after_skipfield)) // previous erased consecutive elements, none following
-			{
-				*(it.skipfield_pointer - *(it.skipfield_pointer - 1)) = *it.skipfield_pointer = static_cast<skipfield_type>(*(it.skipfield_pointer - 1) + 1);
-			}
-			else if ((!prev_skipfield) & after_skipfield) // following erased consecutive elements, none preceding
-			{
-				const skipfield_type following_value = static_cast<skipfield_type>(*(it.skipfield_pointer + 1) + 1);
-				*(it.skipfield_pointer + following_value - 1) = *(it.skipfield_pointer) = following_value;
-
-				const skipfield_type following_previous = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1));
-				const skipfield_type following_next = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1) + 1);
-				*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer)) = following_previous;
-				*(reinterpret_cast<skipfield_pointer_type>(it.element_pointer) + 1) = following_next;
-
-				const skipfield_type index = static_cast<skipfield_type>(it.element_pointer - it.group_pointer->elements);
-
-				if (following_previous != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_previous) + 1) = index; // Set next index of previous free list node to this node's 'next' index
-				}
-
-				if (following_next != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_next)) = index;	// Set previous index of next free list node to this node's 'previous' index
-				}
-				else
-				{
-					it.group_pointer->free_list_head = index;
-				}
-
-				update_value = following_value;
-			}
-			else // both preceding and following consecutive erased elements - erased element is between two skipblocks
+			if (!it.group_pointer->has_erasures())
 			{
-				const skipfield_type preceding_value = *(it.skipfield_pointer - 1);
-				const skipfield_type following_value = static_cast<skipfield_type>(*(it.skipfield_pointer + 1) + 1);
-
-				// Join the skipblocks
-				*(it.skipfield_pointer - preceding_value) = *(it.skipfield_pointer + following_value - 1) = static_cast<skipfield_type>(preceding_value + following_value);
-
-				// Remove the following skipblock's entry from the free list
-				const skipfield_type following_previous = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1));
-				const skipfield_type following_next = *(reinterpret_cast<skipfield_pointer_type>(it.element_pointer + 1) + 1);
-
-				if (following_previous != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_previous) + 1) = following_next; // Set next index of previous free list node to this node's 'next' index
-				}
-
-				if (following_next != std::numeric_limits<skipfield_type>::max())
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(it.group_pointer->elements + following_next)) = following_previous; // Set previous index of next free list node to this node's 'previous' index
-				}
-				else
-				{
-					it.group_pointer->free_list_head = following_previous;
-				}
-
-				update_value = following_value;
+				it.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
+				groups_with_erasures_list_head = it.group_pointer;
 			}
 
-			iterator return_iterator(it.group_pointer, it.element_pointer + update_value, it.skipfield_pointer + update_value);
-
-			if (return_iterator.element_pointer == it.group_pointer->last_endpoint && it.group_pointer->next_group != NULL)
-			{
-				return_iterator.group_pointer = it.group_pointer->next_group;
-				const aligned_pointer_type elements = return_iterator.group_pointer->elements;
-				const skipfield_pointer_type skipfield = return_iterator.group_pointer->skipfield;
-				const skipfield_type skip = *skipfield;
-				return_iterator.element_pointer = elements + skip;
-				return_iterator.skipfield_pointer = skipfield + skip;
-			}
+			--(it.group_pointer->size);
+			const iterator return_iterator = mark_erased(it);
 
 			if (it.element_pointer == begin_iterator.element_pointer) // If original iterator was first element in hive, update it's value with the next non-erased element:
 			{
@@ -2912,7 +4743,7 @@ public:
 
 		if (in_back_block & in_front_block) // ie. only group in hive
 		{
-			// Reset skipfield and free list rather than clearing - leads to fewer allocations/deallocations:
+			// Reset occupancy rather than clearing - leads to fewer allocations/deallocations:
 			reset_only_group_left(it.group_pointer);
 			return end_iterator;
 		}
@@ -2923,7 +4754,7 @@ public:
 
 			update_subsequent_group_numbers(begin_iterator.group_pointer);
 
-			if (it.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // Erasures present within the group, ie. was part of the linked list of groups with erasures.
+			if (it.group_pointer->has_erasures()) // Erasures present within the group, ie. was part of the linked list of groups with erasures.
 			{
 				remove_from_groups_with_erasures_list(it.group_pointer);
 			}
@@ -2932,9 +4763,7 @@ public:
 			deallocate_group(it.group_pointer);
 
 			// note: end iterator only needs to be changed if the deleted group was the final group in the chain ie. not in this case
-			begin_iterator.element_pointer = begin_iterator.group_pointer->elements + *(begin_iterator.group_pointer->skipfield); // If the beginning index has been erased (ie. skipfield != 0), skip to next non-erased element
-			begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield + *(begin_iterator.group_pointer->skipfield);
-
+			begin_iterator = group_begin(begin_iterator.group_pointer); // If the beginning index has been erased, skip to next non-erased element
 			return begin_iterator;
 		}
 		else if (!(in_back_block | in_front_block)) // this is a non-first group but not final group in chain: delete the group, then link previous group to the next group in the chain:
@@ -2944,7 +4773,7 @@ public:
 
 			update_subsequent_group_numbers(return_group);
 
-			if (it.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max())
+			if (it.group_pointer->has_erasures())
 			{
 				remove_from_groups_with_erasures_list(it.group_pointer);
 			}
@@ -2960,20 +4789,17 @@ public:
 			}
 
 			// Return next group's first non-erased element:
-			return iterator(return_group, return_group->elements + *(return_group->skipfield), return_group->skipfield + *(return_group->skipfield));
+			return group_begin(return_group);
 		}
 		else // this is a non-first group and the final group in the chain
 		{
-			if (it.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max())
+			if (it.group_pointer->has_erasures())
 			{
 				remove_from_groups_with_erasures_list(it.group_pointer);
 			}
 
 			it.group_pointer->previous_group->next_group = NULL;
-			end_iterator.group_pointer = it.group_pointer->previous_group; // end iterator needs to be changed as element supplied was the back element of the hive
-			end_iterator.element_pointer = reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield);
-			end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + end_iterator.group_pointer->capacity;
-
+			end_iterator = group_end(it.group_pointer->previous_group); // end iterator needs to be changed as element supplied was the back element of the hive
 			add_group_to_unused_groups_list(it.group_pointer);
 
 			return end_iterator;
@@ -2991,109 +4817,19 @@ public:
 		const_iterator current = iterator1;
 
 		if (current.group_pointer != iterator2.group_pointer) // ie. if start and end iterators are in separate groups
-		{
-			if (current.element_pointer != current.group_pointer->elements + *(current.group_pointer->skipfield)) // if iterator1 is not the first non-erased element in it's group - most common case
-			{
-				size_type number_of_group_erasures = 0;
-
-				// Now update skipfield:
-				const aligned_pointer_type end = iterator1.group_pointer->last_endpoint;
-
-				// Schema: first erase all non-erased elements until end of group & remove all skipblocks post-iterator1 from the free_list. Then, either update preceding skipblock or create new one:
-
-				if (std::is_trivially_destructible<element_type>::value && current.group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max())
-				{
-					number_of_group_erasures += static_cast<size_type>(end - current.element_pointer);
-				}
-				else
-				{
-					while (current.element_pointer != end)
-					{
-						if (*current.skipfield_pointer == 0)
-						{
-							if constexpr (!std::is_trivially_destructible<element_type>::value)
-							{
-								std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer)); // Destruct element
-							}
-
-							++number_of_group_erasures;
-							++current.element_pointer;
-							++current.skipfield_pointer;
-						}
-						else // remove skipblock from group:
-						{
-							const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer));
-							const skipfield_type next_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer) + 1);
-
-							current.element_pointer += *(current.skipfield_pointer);
-							current.skipfield_pointer += *(current.skipfield_pointer);
-
-							if (next_free_list_index == std::numeric_limits<skipfield_type>::max() && prev_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the last skipblock in the free list
-							{
-								remove_from_groups_with_erasures_list(iterator1.group_pointer); // remove group from list of free-list groups - will be added back in down below, but not worth optimizing for
-								iterator1.group_pointer->free_list_head = std::numeric_limits<skipfield_type>::max();
-								number_of_group_erasures += static_cast<size_type>(end - current.element_pointer);
-
-								if constexpr (!std::is_trivially_destructible<element_type>::value)
-								{
-									while (current.element_pointer != end) // miniloop - avoid checking skipfield for rest of elements in group, as there are no more skipped elements now
-									{
-										std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer++)); // Destruct element
-									}
-								}
-
-								break; // end overall while loop
-							}
-							else if (next_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the head of the free list
-							{
-								current.group_pointer->free_list_head = prev_free_list_index; // make free list head equal to next free list node
-								*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + prev_free_list_index) + 1) = std::numeric_limits<skipfield_type>::max();
-							}
-							else // either a tail or middle free list node
-							{
-								*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + next_free_list_index)) = prev_free_list_index;
-
-								if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the tail free list node
-								{
-									*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + prev_free_list_index) + 1) = next_free_list_index;
-								}
-							}
-						}
-					}
-				}
-
-
-				const skipfield_type previous_node_value = *(iterator1.skipfield_pointer - 1);
-				const skipfield_type distance_to_end = static_cast<skipfield_type>(end - iterator1.element_pointer);
-
-
-				if (previous_node_value == 0) // no previous skipblock
-				{
-					*iterator1.skipfield_pointer = distance_to_end; // set start node value
-					*(iterator1.skipfield_pointer + distance_to_end - 1) = distance_to_end; // set end node value
-
-					const skipfield_type index = static_cast<skipfield_type>(iterator1.element_pointer - iterator1.group_pointer->elements);
-
-					if (iterator1.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
-					{
-						*(reinterpret_cast<skipfield_pointer_type>(iterator1.group_pointer->elements + iterator1.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the iterator1 element
-					}
-					else
-					{
-						iterator1.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
-						groups_with_erasures_list_head = iterator1.group_pointer;
-					}
+		{
+			if (current.element_pointer != group_begin(current.group_pointer).element_pointer) // if iterator1 is not the first non-erased element in it's group - most common case
+			{
+				const bool had_erasures = current.group_pointer->has_erasures();
+				const size_type number_of_group_erasures = erase_in_group(current, current.group_pointer->last_endpoint);
 
-					*(reinterpret_cast<skipfield_pointer_type>(iterator1.element_pointer)) = iterator1.group_pointer->free_list_head;
-					*(reinterpret_cast<skipfield_pointer_type>(iterator1.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
-					iterator1.group_pointer->free_list_head = index;
-				}
-				else
-				{ // update previous skipblock, no need to update free list:
-					*(iterator1.skipfield_pointer - previous_node_value) = *(iterator1.skipfield_pointer + distance_to_end - 1) = static_cast<skipfield_type>(previous_node_value + distance_to_end);
+				if (!had_erasures)
+				{
+					current.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
+					groups_with_erasures_list_head = current.group_pointer;
 				}
 
-				iterator1.group_pointer->size = static_cast<skipfield_type>(iterator1.group_pointer->size - number_of_group_erasures);
+				current.group_pointer->size = static_cast<capacity_type>(current.group_pointer->size - number_of_group_erasures);
 				total_size -= number_of_group_erasures;
 
 				current.group_pointer = current.group_pointer->next_group;
@@ -3105,22 +4841,9 @@ public:
 
 			while (current.group_pointer != iterator2.group_pointer)
 			{
-				if constexpr (!std::is_trivially_destructible<element_type>::value)
-				{
-					current.element_pointer = current.group_pointer->elements + *(current.group_pointer->skipfield);
-					current.skipfield_pointer = current.group_pointer->skipfield + *(current.group_pointer->skipfield);
-					const aligned_pointer_type end = current.group_pointer->last_endpoint;
-
-					do
-					{
-						std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer)); // Destruct element
-						const skipfield_type skip = *(++current.skipfield_pointer);
-						current.element_pointer += static_cast<size_type>(skip) + 1u;
-						current.skipfield_pointer += skip;
-					} while (current.element_pointer != end);
-				}
+				destroy_group_elements(current.group_pointer);
 
-				if (current.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max())
+				if (current.group_pointer->has_erasures())
 				{
 					remove_from_groups_with_erasures_list(current.group_pointer);
 				}
@@ -3140,8 +4863,7 @@ public:
 				}
 			}
 
-			current.element_pointer = current.group_pointer->elements + *(current.group_pointer->skipfield);
-			current.skipfield_pointer = current.group_pointer->skipfield + *(current.group_pointer->skipfield);
+			current = group_begin(current.group_pointer);
 			current.group_pointer->previous_group = previous_group;
 
 			if (previous_group != NULL)
@@ -3161,135 +4883,35 @@ public:
 
 		// Final group:
 		// Code explanation:
-		// If not erasing entire final group, 1. Destruct elements (if non-trivial destructor) and add locations to group free list. 2. process skipfield.
-		// If erasing entire group, 1. Destruct elements (if non-trivial destructor), 2. if no elements left in hive, reset the group 3. otherwise reset end_iterator and remove group from groups-with-erasures list (if free list of erasures present)
+		// If not erasing entire final group, 1. Destruct elements (if non-trivial destructor) and mark their locations as erased.
+		// If erasing entire group, 1. Destruct elements (if non-trivial destructor), 2. if no elements left in hive, reset the group 3. otherwise reset end_iterator and remove group from groups-with-erasures list (if erasures present)
 
-		if (iterator2.element_pointer != end_iterator.element_pointer || current.element_pointer != current.group_pointer->elements + *(current.group_pointer->skipfield)) // ie. not erasing entire group
+		if (iterator2.element_pointer != end_iterator.element_pointer || current.element_pointer != group_begin(current.group_pointer).element_pointer) // ie. not erasing entire group
 		{
-			size_type number_of_group_erasures = 0;
-			// Schema: first erased all non-erased elements until end of group & remove all skipblocks post-iterator2 from the free_list. Then, either update preceding skipblock or create new one:
-
-			const const_iterator current_saved = current;
-
-			if (std::is_trivially_destructible<element_type>::value && current.group_pointer->free_list_head == std::numeric_limits<skipfield_type>::max())
-			{
-				number_of_group_erasures += static_cast<size_type>(iterator2.element_pointer - current.element_pointer);
-			}
-			else
-			{
-				while (current.element_pointer != iterator2.element_pointer)
-				{
-					if (*current.skipfield_pointer == 0)
-					{
-						if constexpr (!std::is_trivially_destructible<element_type>::value)
-						{
-							std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer)); // Destruct element
-						}
-
-						++number_of_group_erasures;
-						++current.element_pointer;
-						++current.skipfield_pointer;
-					}
-					else // remove skipblock from group:
-					{
-						const skipfield_type prev_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer));
-						const skipfield_type next_free_list_index = *(reinterpret_cast<skipfield_pointer_type>(current.element_pointer) + 1);
-
-						current.element_pointer += *(current.skipfield_pointer);
-						current.skipfield_pointer += *(current.skipfield_pointer);
-
-						if (next_free_list_index == std::numeric_limits<skipfield_type>::max() && prev_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the last skipblock in the free list
-						{
-							remove_from_groups_with_erasures_list(iterator2.group_pointer); // remove group from list of free-list groups - will be added back in down below, but not worth optimizing for
-							iterator2.group_pointer->free_list_head = std::numeric_limits<skipfield_type>::max();
-							number_of_group_erasures += static_cast<size_type>(iterator2.element_pointer - current.element_pointer);
-
-							if constexpr (!std::is_trivially_destructible<element_type>::value)
-							{
-								while (current.element_pointer != iterator2.element_pointer)
-								{
-									std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer++)); // Destruct element
-								}
-							}
-
-							break; // end overall while loop
-						}
-						else if (next_free_list_index == std::numeric_limits<skipfield_type>::max()) // if this is the head of the free list
-						{
-							current.group_pointer->free_list_head = prev_free_list_index;
-							*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + prev_free_list_index) + 1) = std::numeric_limits<skipfield_type>::max();
-						}
-						else
-						{
-							*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + next_free_list_index)) = prev_free_list_index;
-
-							if (prev_free_list_index != std::numeric_limits<skipfield_type>::max()) // ie. not the tail free list node
-							{
-								*(reinterpret_cast<skipfield_pointer_type>(current.group_pointer->elements + prev_free_list_index) + 1) = next_free_list_index;
-							}
-						}
-					}
-				}
-			}
-
-
-			const skipfield_type distance_to_iterator2 = static_cast<skipfield_type>(iterator2.element_pointer - current_saved.element_pointer);
-			const skipfield_type index = static_cast<skipfield_type>(current_saved.element_pointer - iterator2.group_pointer->elements);
-
-
-			if (index == 0 || *(current_saved.skipfield_pointer - 1) == 0) // element is either at start of group or previous skipfield node is 0
-			{
-				*(current_saved.skipfield_pointer) = distance_to_iterator2;
-				*(iterator2.skipfield_pointer - 1) = distance_to_iterator2;
-
-				if (iterator2.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(iterator2.group_pointer->elements + iterator2.group_pointer->free_list_head) + 1) = index;
-				}
-				else
-				{
-					iterator2.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
-					groups_with_erasures_list_head = iterator2.group_pointer;
-				}
+			const bool had_erasures = iterator2.group_pointer->has_erasures();
+			const size_type number_of_group_erasures = erase_in_group(current, iterator2.element_pointer);
 
-				*(reinterpret_cast<skipfield_pointer_type>(current_saved.element_pointer)) = iterator2.group_pointer->free_list_head;
-				*(reinterpret_cast<skipfield_pointer_type>(current_saved.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
-				iterator2.group_pointer->free_list_head = index;
-			}
-			else // If iterator 1 & 2 are in same group, but iterator 1 was not at start of group, and previous skipfield node is an end node in a skipblock:
+			if (!had_erasures)
 			{
-				// Just update existing skipblock, no need to create new free list node:
-				const skipfield_type prev_node_value = *(current_saved.skipfield_pointer - 1);
-				*(current_saved.skipfield_pointer - prev_node_value) = static_cast<skipfield_type>(prev_node_value + distance_to_iterator2);
-				*(iterator2.skipfield_pointer - 1) = static_cast<skipfield_type>(prev_node_value + distance_to_iterator2);
+				iterator2.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
+				groups_with_erasures_list_head = iterator2.group_pointer;
 			}
 
-
 			if (iterator1.element_pointer == begin_iterator.element_pointer)
 			{
 				begin_iterator = iterator2;
 			}
 
-			iterator2.group_pointer->size = static_cast<skipfield_type>(iterator2.group_pointer->size - number_of_group_erasures);
+			iterator2.group_pointer->size = static_cast<capacity_type>(iterator2.group_pointer->size - number_of_group_erasures);
 			total_size -= number_of_group_erasures;
 		}
 		else // ie. full group erasure
 		{
-			if constexpr (!std::is_trivially_destructible<element_type>::value)
-			{
-				while(current.element_pointer != iterator2.element_pointer)
-				{
-					std::allocator_traits<allocator_type>::destroy(*this, reinterpret_cast<pointer>(current.element_pointer));
-					++current.skipfield_pointer;
-					current.element_pointer += static_cast<size_type>(*current.skipfield_pointer) + 1u;
-					current.skipfield_pointer += *current.skipfield_pointer;
-				}
-			}
-
+			destroy_group_elements(current.group_pointer);
 
 			if ((total_size -= current.group_pointer->size) != 0) // ie. either previous_group != NULL or next_group != NULL
 			{
-				if (current.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max())
+				if (current.group_pointer->has_erasures())
 				{
 					remove_from_groups_with_erasures_list(current.group_pointer);
 				}
@@ -3298,18 +4920,13 @@ public:
 
 				if (current.group_pointer == end_iterator.group_pointer)
 				{
-					end_iterator.group_pointer = current.group_pointer->previous_group;
-					end_iterator.element_pointer = end_iterator.group_pointer->last_endpoint;
-					end_iterator.skipfield_pointer = end_iterator.group_pointer->skipfield + end_iterator.group_pointer->capacity;
+					end_iterator = group_end(current.group_pointer->previous_group);
 					add_group_to_unused_groups_list(current.group_pointer);
 					return end_iterator;
 				}
 				else if (current.group_pointer == begin_iterator.group_pointer)
 				{
-					begin_iterator.group_pointer = current.group_pointer->next_group;
-					const skipfield_type skip = *(begin_iterator.group_pointer->skipfield);
-					begin_iterator.element_pointer = begin_iterator.group_pointer->elements + skip;
-					begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield + skip;
+					begin_iterator = group_begin(current.group_pointer->next_group);
 				}
 
 				if (current.group_pointer->next_group != end_iterator.group_pointer)
@@ -3324,7 +4941,7 @@ public:
 			}
 			else // ie. hive is now empty
 			{
-				// Reset skipfield and free list rather than clearing - leads to fewer allocations/deallocations:
+				// Reset occupancy rather than clearing - leads to fewer allocations/deallocations:
 				reset_only_group_left(current.group_pointer);
 				return end_iterator;
 			}
@@ -3399,8 +5016,7 @@ private:
 			end_iterator.group_pointer->next_group = unused_groups_head;
 		}
 
-		begin_iterator.element_pointer = begin_iterator.group_pointer->elements;
-		begin_iterator.skipfield_pointer = begin_iterator.group_pointer->skipfield;
+		begin_iterator = iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements);
 		groups_with_erasures_list_head = NULL;
 		total_size = 0;
 	}
@@ -3444,6 +5060,106 @@ private:
 
 
 
+	// Copy core for trivially-copyable types - duplicates each source group, including its occupancy data (skipfield and erased-element free list, or bitset), via a single memcpy of the memory block. This hive's unused groups are reused where their capacities match:
+	void copy_groups(const hive &source)
+	{
+		clear();
+
+		if (source.total_size == 0)
+		{
+			return;
+		}
+
+		group_pointer_type first_group = NULL, last_group = NULL;
+
+		try
+		{
+			for (group_pointer_type source_group = source.begin_iterator.group_pointer; source_group != NULL; source_group = source_group->next_group)
+			{
+				group_pointer_type new_group = NULL;
+
+				for (group_pointer_type *current = &unused_groups_head; *current != NULL; current = &((*current)->next_group)) // Where this hive was previously copied from a similar source, the first unused group usually matches
+				{
+					if ((*current)->capacity == source_group->capacity)
+					{
+						new_group = *current;
+						*current = new_group->next_group;
+						break;
+					}
+				}
+
+				if (new_group == NULL)
+				{
+					new_group = allocate_new_group(source_group->capacity, last_group);
+					total_capacity += source_group->capacity;
+				}
+
+				std::memcpy(static_cast<void *>(&*new_group->elements), static_cast<const void *>(&*source_group->elements), aligned_block_size(source_group->capacity) * sizeof(aligned_allocation_struct));
+				new_group->last_endpoint = new_group->elements + (source_group->last_endpoint - source_group->elements);
+				new_group->next_group = NULL;
+				new_group->previous_group = last_group;
+				new_group->copy_erasure_state(*source_group);
+				new_group->size = source_group->size;
+				new_group->erasures_list_next_group = NULL;
+				new_group->group_number = source_group->group_number;
+
+				if (last_group == NULL)
+				{
+					first_group = new_group;
+				}
+				else
+				{
+					last_group->next_group = new_group;
+				}
+
+				last_group = new_group;
+			}
+		}
+		catch (...)
+		{
+			while (first_group != NULL) // Retain the groups copied so far as unused groups, or deallocate them if there is no group chain for them to be retained by
+			{
+				const group_pointer_type next_group = first_group->next_group;
+
+				if (begin_iterator.group_pointer != NULL)
+				{
+					add_group_to_unused_groups_list(first_group);
+				}
+				else
+				{
+					total_capacity -= first_group->capacity;
+					deallocate_group(first_group);
+				}
+
+				first_group = next_group;
+			}
+
+			throw;
+		}
+
+		if (begin_iterator.group_pointer != NULL) // Retain the group left by clear() for reuse by subsequent copies
+		{
+			add_group_to_unused_groups_list(begin_iterator.group_pointer);
+		}
+
+		begin_iterator = iterator(first_group, first_group->elements + (source.begin_iterator.element_pointer - source.begin_iterator.group_pointer->elements));
+		end_iterator = group_end(last_group);
+		total_size = source.total_size;
+
+		for (group_pointer_type current_group = last_group; current_group != NULL; current_group = current_group->previous_group) // Rebuild groups-with-erasures list
+		{
+			if (current_group->has_erasures())
+			{
+				current_group->erasures_list_next_group = groups_with_erasures_list_head;
+				groups_with_erasures_list_head = current_group;
+			}
+		}
+
+		invalidate_group_index();
+	}
+
+
+
 
 public:
 
@@ -3523,14 +5239,17 @@ public:
 	inline size_type memory() const noexcept
 	{
 		size_type memory_use = sizeof(*this); // sizeof hive basic structure
-		end_iterator.group_pointer->next_group = unused_groups_head; // temporarily link the main groups and unused groups (reserved groups) in order to only have one loop below instead of several
 
-		for(group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+		{
+			memory_use += sizeof(group) + (aligned_block_size(current->capacity) * sizeof(aligned_allocation_struct)); // add memory block sizes and the size of the group structs themselves. The original calculation, including divisor, is necessary in order to correctly round up the number of allocations
+		}
+
+		for (group_pointer_type current = unused_groups_head; current != NULL; current = current->next_group)
 		{
-			memory_use += sizeof(group) + (PLF_GROUP_ALIGNED_BLOCK_SIZE(current->capacity) * sizeof(aligned_allocation_struct)); // add memory block sizes and the size of the group structs themselves. The original calculation, including divisor, is necessary in order to correctly round up the number of allocations
+			memory_use += sizeof(group) + (aligned_block_size(current->capacity) * sizeof(aligned_allocation_struct));
 		}
 
-		end_iterator.group_pointer->next_group = NULL; // unlink main groups and unused groups
 		return memory_use;
 	}
 
@@ -3563,11 +5282,27 @@ public:
 	void reshape(const plf::hive_limits capacities)
 	{
 		check_capacities_conformance(capacities);
-		tuple_allocator_pair.min_group_capacity = static_cast<skipfield_type>(capacities.min);
-		group_allocator_pair.max_group_capacity = static_cast<skipfield_type>(capacities.max);
+		tuple_allocator_pair.min_group_capacity = static_cast<capacity_type>(capacities.min);
+		group_allocator_pair.max_group_capacity = static_cast<capacity_type>(capacities.max);
+
+		// Unused groups outside of the new limits would otherwise be reused by insertion:
+		for (group_pointer_type *current = &unused_groups_head; *current != NULL;)
+		{
+			if ((*current)->capacity < tuple_allocator_pair.min_group_capacity || (*current)->capacity > group_allocator_pair.max_group_capacity)
+			{
+				const group_pointer_type next_group = (*current)->next_group;
+				total_capacity -= (*current)->capacity;
+				deallocate_group(*current);
+				*current = next_group;
+			}
+			else
+			{
+				current = &((*current)->next_group);
+			}
+		}
 
 		// Need to check all group sizes here, because splice might append smaller blocks to the end of a larger block:
-		for (group_pointer_type current = begin_iterator.group_pointer; current != end_iterator.group_pointer; current = current->next_group)
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
 		{
 			if (current->capacity < tuple_allocator_pair.min_group_capacity || current->capacity > group_allocator_pair.max_group_capacity)
 			{
@@ -3627,6 +5362,16 @@ public:
 	inline hive & operator = (const hive &source)
 	{
 		assert(&source != this);
+
+		if constexpr (std::is_trivially_copyable<element_type>::value)
+		{
+			if (source.tuple_allocator_pair.min_group_capacity >= tuple_allocator_pair.min_group_capacity && source.group_allocator_pair.max_group_capacity <= group_allocator_pair.max_group_capacity) // ie. the source's groups are within this hive's capacity limits
+			{
+				copy_groups(source);
+				return *this;
+			}
+		}
+
 		range_assign(source.begin_iterator, source.total_size);
 		return *this;
 	}
@@ -3639,9 +5384,11 @@ public:
 		assert(&source != this);
 		destroy_all_data();
 
-		if constexpr (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value)
+		if constexpr (occupancy::trivial_pointers)
 		{
+			const group_index_holder index = group_index;
 			std::memcpy(static_cast<void *>(this), &source, sizeof(hive));
+			group_index = index;
 		}
 		else
 		{
@@ -3656,6 +5403,8 @@ public:
 		}
 
 		source.blank();
+		invalidate_group_index();
+		source.invalidate_group_index();
 		return *this;
 	}
 
@@ -3748,7 +5497,7 @@ public:
 		new_capacity -= total_capacity;
 
 		size_type number_of_max_groups = new_capacity / group_allocator_pair.max_group_capacity;
-		skipfield_type remainder = static_cast<skipfield_type>(new_capacity - (number_of_max_groups * group_allocator_pair.max_group_capacity));
+		capacity_type remainder = static_cast<capacity_type>(new_capacity - (number_of_max_groups * group_allocator_pair.max_group_capacity));
 
 
 		if (remainder == 0)
@@ -3767,8 +5516,8 @@ public:
 		if (begin_iterator.group_pointer == NULL) // Most common scenario - empty hive
 		{
 			initialize(remainder);
-			begin_iterator.group_pointer->last_endpoint = begin_iterator.group_pointer->elements; // last_endpoint initially == elements + 1 via default constructor
-			begin_iterator.group_pointer->size = 0; // 1 by default
+			begin_iterator.group_pointer->reset(0, NULL, NULL, begin_iterator.group_pointer->group_number); // The new group is initially marked as holding one element
+			end_iterator = begin_iterator;
 
 			if (number_of_max_groups == 0)
 			{
@@ -3815,20 +5564,117 @@ public:
 
 private:
 
+	struct group_address_less
+	{
+		inline bool operator() (const group_pointer_type lh, const group_pointer_type rh) const noexcept
+		{
+			return lh->elements < rh->elements;
+		}
+
+		inline bool operator() (const aligned_pointer_type lh, const group_pointer_type rh) const noexcept
+		{
+			return lh < rh->elements;
+		}
+	};
+
+
+
+	// Returns false if memory for the index could not be allocated:
+	bool rebuild_group_index() const noexcept
+	{
+		const group_index_pointer_type index = group_index.index;
+		size_type number_of_groups = 0;
+
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+		{
+			++number_of_groups;
+		}
+
+		for (group_pointer_type current = unused_groups_head; current != NULL; current = current->next_group)
+		{
+			++number_of_groups;
+		}
+
+		if (number_of_groups > index->capacity)
+		{
+			group_pointer_allocator_type group_pointer_allocator(*this);
+			const size_type new_capacity = (number_of_groups > index->capacity * 2) ? number_of_groups : index->capacity * 2;
+			group_pointer_pointer_type new_groups;
+
+			try
+			{
+				new_groups = std::allocator_traits<group_pointer_allocator_type>::allocate(group_pointer_allocator, new_capacity);
+			}
+			catch (...)
+			{
+				return false;
+			}
+
+			if (index->groups != NULL)
+			{
+				std::allocator_traits<group_pointer_allocator_type>::deallocate(group_pointer_allocator, index->groups, index->capacity);
+			}
+
+			index->groups = new_groups;
+			index->capacity = new_capacity;
+		}
+
+		group_pointer_pointer_type current_entry = index->groups;
+
+		for (group_pointer_type current = begin_iterator.group_pointer; current != NULL; current = current->next_group)
+		{
+			*current_entry++ = current; // group pointers are trivial as raw or fancy pointers are required to be, so no construction is necessary
+		}
+
+		for (group_pointer_type current = unused_groups_head; current != NULL; current = current->next_group)
+		{
+			*current_entry++ = current;
+		}
+
+		std::sort(index->groups, current_entry, group_address_less());
+		index->number_of_groups = number_of_groups;
+		index->stale = false;
+		return true;
+	}
+
+
+
 	template <bool is_const>
 	hive_iterator<is_const> get_it(const pointer element_pointer) const noexcept
 	{
 		typedef hive_iterator<is_const> iterator_type;
 
-		if (total_size != 0) // Necessary here to prevent a pointer matching to an empty hive with one memory block retained with the skipfield wiped (see erase())
+		if (total_size != 0) // Necessary here to prevent a pointer matching to an empty hive with one memory block retained with the occupancy wiped (see erase())
 		{
+			if (group_index.index != NULL && (!group_index.index->stale || rebuild_group_index())) // Find the group with the highest element memory address not above element_pointer:
+			{
+				const group_pointer_pointer_type groups_end = group_index.index->groups + group_index.index->number_of_groups;
+				const group_pointer_pointer_type following = std::upper_bound(group_index.index->groups, groups_end, reinterpret_cast<aligned_pointer_type>(element_pointer), group_address_less());
+
+				if (following == group_index.index->groups || reinterpret_cast<aligned_pointer_type>(element_pointer) >= (*(following - 1))->last_endpoint)
+				{
+					return end_iterator;
+				}
+
+				const group_pointer_type found_group = *(following - 1);
+
+				for (group_pointer_type current = unused_groups_head; current != NULL; current = current->next_group) // Unused groups are indexed but hold no elements. Their number is usually small
+				{
+					if (current == found_group)
+					{
+						return end_iterator;
+					}
+				}
+
+				return (is_element(found_group, reinterpret_cast<aligned_pointer_type>(element_pointer))) ? iterator_type(found_group, reinterpret_cast<aligned_pointer_type>(element_pointer)) : static_cast<iterator_type>(end_iterator);
+			}
+
 			 // Start with last group first, as will be the largest group in most cases:
 			for (group_pointer_type current_group = end_iterator.group_pointer; current_group != NULL; current_group = current_group->previous_group)
 			{
-				if (reinterpret_cast<aligned_pointer_type>(element_pointer) >= current_group->elements && reinterpret_cast<aligned_pointer_type>(element_pointer) < reinterpret_cast<aligned_pointer_type>(current_group->skipfield))
+				if (reinterpret_cast<aligned_pointer_type>(element_pointer) >= current_group->elements && reinterpret_cast<aligned_pointer_type>(element_pointer) < current_group->end_of_elements())
 				{
-					const skipfield_pointer_type skipfield_pointer = current_group->skipfield + (reinterpret_cast<aligned_pointer_type>(element_pointer) - current_group->elements);
-					return (*skipfield_pointer == 0) ? iterator_type(current_group, reinterpret_cast<aligned_pointer_type>(element_pointer), skipfield_pointer) : static_cast<iterator_type>(end_iterator); // If element has been erased, return end()
+					return (reinterpret_cast<aligned_pointer_type>(element_pointer) < current_group->last_endpoint && is_element(current_group, reinterpret_cast<aligned_pointer_type>(element_pointer))) ? iterator_type(current_group, reinterpret_cast<aligned_pointer_type>(element_pointer)) : static_cast<iterator_type>(end_iterator); // If element has been erased, return end()
 				}
 			}
 		}
@@ -3854,6 +5700,48 @@ public:
 
 
 
+	// Makes get_iterator() O(log number of groups) instead of O(number of groups), by keeping an index of the hive's groups sorted by memory address. The index is rebuilt lazily, on the first get_iterator() call after groups have been allocated or deallocated, in O(number of groups * log number of groups) time. It belongs to this hive object and is not transferred by move, swap or copy:
+	void enable_group_index()
+	{
+		if (group_index.index == NULL)
+		{
+			group_index_allocator_type group_index_allocator(*this);
+			const group_index_pointer_type index = std::allocator_traits<group_index_allocator_type>::allocate(group_index_allocator, 1);
+			index->groups = NULL;
+			index->number_of_groups = 0;
+			index->capacity = 0;
+			index->stale = true;
+			group_index.index = index;
+		}
+	}
+
+
+
+	void disable_group_index() noexcept
+	{
+		if (group_index.index != NULL)
+		{
+			if (group_index.index->groups != NULL)
+			{
+				group_pointer_allocator_type group_pointer_allocator(*this);
+				std::allocator_traits<group_pointer_allocator_type>::deallocate(group_pointer_allocator, group_index.index->groups, group_index.index->capacity);
+			}
+
+			group_index_allocator_type group_index_allocator(*this);
+			std::allocator_traits<group_index_allocator_type>::deallocate(group_index_allocator, group_index.index, 1);
+			group_index.index = NULL;
+		}
+	}
+
+
+
+	inline bool group_index_enabled() const noexcept
+	{
+		return group_index.index != NULL;
+	}
+
+
+
 	inline allocator_type get_allocator() const noexcept
 	{
 		return *this;
@@ -3880,8 +5768,10 @@ public:
 			return;
 		}
 
-		// If there's more unused element locations in back memory block of destination than in back memory block of source, swap with source to reduce number of skipped elements during iteration, and reduce size of free-list:
-		if ((reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) > (reinterpret_cast<aligned_pointer_type>(source.end_iterator.group_pointer->skipfield) - source.end_iterator.element_pointer))
+		// If there's more unused element locations in back memory block of destination than in back memory block of source, swap with source to reduce number of skipped elements during iteration, and reduce size of free-list (unless that would mean renumbering more groups, see has_no_more_groups_than()):
+		const bool swapped = (end_iterator.group_pointer->end_of_elements() - end_iterator.element_pointer) > (source.end_iterator.group_pointer->end_of_elements() - source.end_iterator.element_pointer) && has_no_more_groups_than(source);
+
+		if (swapped)
 		{
 			swap(source);
 		}
@@ -3900,85 +5790,63 @@ public:
 		}
 
 
-		// Add source list of groups-with-erasures to destination list of groups-with-erasures:
-		if (source.groups_with_erasures_list_head != NULL)
-		{
-			if (groups_with_erasures_list_head != NULL)
-			{
-				group_pointer_type tail_group = groups_with_erasures_list_head;
+		// Join the lists of groups-with-erasures (the list is unordered, and walking the original source's list rather than the original destination's keeps this independent of the destination's size):
+		const group_pointer_type walked_list_head = (swapped) ? groups_with_erasures_list_head : source.groups_with_erasures_list_head;
+		const group_pointer_type other_list_head = (swapped) ? source.groups_with_erasures_list_head : groups_with_erasures_list_head;
 
-				while (tail_group->erasures_list_next_group != NULL)
-				{
-					tail_group = tail_group->erasures_list_next_group;
-				}
+		if (walked_list_head != NULL)
+		{
+			group_pointer_type tail_group = walked_list_head;
 
-				tail_group->erasures_list_next_group = source.groups_with_erasures_list_head;
-			}
-			else
+			while (tail_group->erasures_list_next_group != NULL)
 			{
-				groups_with_erasures_list_head = source.groups_with_erasures_list_head;
+				tail_group = tail_group->erasures_list_next_group;
 			}
-		}
 
+			tail_group->erasures_list_next_group = other_list_head;
+			groups_with_erasures_list_head = walked_list_head;
+		}
+		else
+		{
+			groups_with_erasures_list_head = other_list_head;
+		}
 
-		const skipfield_type distance_to_end = static_cast<skipfield_type>(reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer);
 
-		if (distance_to_end != 0) // 0 == edge case
+		if (end_iterator.element_pointer != end_iterator.group_pointer->end_of_elements()) // ie. not the edge case of a full back group
 		{	 // Mark unused element memory locations from back group as skipped/erased:
-
-			// Update skipfield:
-			const skipfield_type previous_node_value = *(end_iterator.skipfield_pointer - 1);
-			end_iterator.group_pointer->last_endpoint = reinterpret_cast<aligned_pointer_type>(end_iterator.group_pointer->skipfield);
-
-			if (previous_node_value == 0) // no previous skipblock
+			if (!end_iterator.group_pointer->has_erasures())
 			{
-				*end_iterator.skipfield_pointer = distance_to_end;
-				*(end_iterator.skipfield_pointer + distance_to_end - 1) = distance_to_end;
-
-				const skipfield_type index = static_cast<skipfield_type>(end_iterator.element_pointer - end_iterator.group_pointer->elements);
-
-				if (end_iterator.group_pointer->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
-				{
-					*(reinterpret_cast<skipfield_pointer_type>(end_iterator.group_pointer->elements + end_iterator.group_pointer->free_list_head) + 1) = index; // set prev free list head's 'next index' number to the index of the current element
-				}
-				else
-				{
-					end_iterator.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
-					groups_with_erasures_list_head = end_iterator.group_pointer;
-				}
-
-				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer)) = end_iterator.group_pointer->free_list_head;
-				*(reinterpret_cast<skipfield_pointer_type>(end_iterator.element_pointer) + 1) = std::numeric_limits<skipfield_type>::max();
-				end_iterator.group_pointer->free_list_head = index;
-			}
-			else
-			{ // update previous skipblock, no need to update free list:
-				*(end_iterator.skipfield_pointer - previous_node_value) = *(end_iterator.skipfield_pointer + distance_to_end - 1) = static_cast<skipfield_type>(previous_node_value + distance_to_end);
+				end_iterator.group_pointer->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures free list
+				groups_with_erasures_list_head = end_iterator.group_pointer;
 			}
-		}
 
+			mark_remainder_erased(end_iterator);
+		}
 
-		// Update subsequent group numbers:
-		group_pointer_type current_group = source.begin_iterator.group_pointer;
-		size_type current_group_number = end_iterator.group_pointer->group_number;
 
-		do
+		// Renumber the source's groups to follow the destination's back group:
 		{
-			current_group->group_number = ++current_group_number;
-			current_group = current_group->next_group;
-		} while (current_group != NULL);
+			group_pointer_type current_group = source.begin_iterator.group_pointer;
+			size_type current_group_number = end_iterator.group_pointer->group_number;
+
+			do
+			{
+				current_group->group_number = ++current_group_number;
+				current_group = current_group->next_group;
+			} while (current_group != NULL);
+		}
 
 
 		// Join the destination and source group chains:
 		end_iterator.group_pointer->next_group = source.begin_iterator.group_pointer;
 		source.begin_iterator.group_pointer->previous_group = end_iterator.group_pointer;
+		source.trim(); // Remove source unused groups before taking on the source's capacity
 		end_iterator = source.end_iterator;
 		total_size += source.total_size;
 		total_capacity += source.total_capacity;
-
-		// Remove source unused groups:
-		source.trim();
 		source.blank();
+		invalidate_group_index();
+		source.invalidate_group_index();
 	}
 
 
@@ -4079,14 +5947,15 @@ public:
 	{
 		assert(&source != this);
 
-		if constexpr (std::is_trivial<group_pointer_type>::value && std::is_trivial<aligned_pointer_type>::value && std::is_trivial<skipfield_pointer_type>::value) // if all pointer types are trivial we can just copy using memcpy - avoids constructors/destructors etc and is faster
+		if constexpr (occupancy::trivial_pointers) // if all pointer types are trivial we can just copy using memcpy - avoids constructors/destructors etc and is faster
 		{
 			char temp[sizeof(hive)];
 			std::memcpy(&temp, static_cast<void *>(this), sizeof(hive));
 			std::memcpy(static_cast<void *>(this), static_cast<void *>(&source), sizeof(hive));
 			std::memcpy(static_cast<void *>(&source), &temp, sizeof(hive));
+			std::swap(group_index, source.group_index);
 		}
-		else if constexpr (std::is_move_assignable<group_pointer_type>::value && std::is_move_assignable<aligned_pointer_type>::value && std::is_move_assignable<skipfield_pointer_type>::value && std::is_move_constructible<group_pointer_type>::value && std::is_move_constructible<aligned_pointer_type>::value && std::is_move_constructible<skipfield_pointer_type>::value)
+		else if constexpr (std::is_move_assignable<group_pointer_type>::value && std::is_move_assignable<aligned_pointer_type>::value && std::is_move_constructible<group_pointer_type>::value && std::is_move_constructible<aligned_pointer_type>::value)
 		{
 			hive temp(std::move(source));
 			source = std::move(*this);
@@ -4097,7 +5966,7 @@ public:
 			const iterator 					swap_end_iterator = end_iterator, swap_begin_iterator = begin_iterator;
 			const group_pointer_type		swap_groups_with_erasures_list_head = groups_with_erasures_list_head, swap_unused_groups_head = unused_groups_head;
 			const size_type					swap_total_size = total_size, swap_total_capacity = total_capacity;
-			const skipfield_type 			swap_min_group_capacity = tuple_allocator_pair.min_group_capacity, swap_max_group_capacity = group_allocator_pair.max_group_capacity;
+			const capacity_type 			swap_min_group_capacity = tuple_allocator_pair.min_group_capacity, swap_max_group_capacity = group_allocator_pair.max_group_capacity;
 
 			end_iterator = source.end_iterator;
 			begin_iterator = source.begin_iterator;
@@ -4117,6 +5986,9 @@ public:
 			source.tuple_allocator_pair.min_group_capacity = swap_min_group_capacity;
 			source.group_allocator_pair.max_group_capacity = swap_max_group_capacity;
 		}
+
+		invalidate_group_index();
+		source.invalidate_group_index();
 	}
 
 }; // hive
@@ -4208,6 +6080,6 @@ namespace std
 
 
 #undef PLF_MIN_BLOCK_CAPACITY
-#undef PLF_GROUP_ALIGNED_BLOCK_SIZE
+#undef PLF_EXECUTION_POLICY_SUPPORT
 
 #endif // PLF_HIVE_H
@@ -0,0 +1,1145 @@
+// zLib license (https://www.zlib.net/zlib_license.html):
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// 	claim that you wrote the original software. If you use this software
+// 	in a product, an acknowledgement in the product documentation would be
+// 	appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+// 	misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+// A structure-of-arrays variant of plf::colony. Each element is a row of fields, and each group stores every field in its own array, alongside the same jump-counting skipfield and per-group free list of erased skipblocks that colony uses. Iterators yield proxy references (tuples of references to a row's fields), and for_each<column_indexes...>() visits only the requested columns, so iterating one or two fields of a wide row only touches those fields' memory. Requires C++17.
+
+#ifndef PLF_SOA_COLONY_H
+#define PLF_SOA_COLONY_H
+
+#include <algorithm> // std::max
+#include <cassert>	// assert
+#include <cstddef> // std::ptrdiff_t, size_t
+#include <cstring>	// memset
+#include <limits>  // std::numeric_limits
+#include <memory> // std::allocator, std::allocator_traits
+#include <iterator> // std::bidirectional_iterator_tag
+#include <stdexcept> // std::length_error
+#include <tuple> // std::tuple, std::get, std::tuple_element_t, std::apply
+#include <type_traits> // std::is_trivially_destructible, std::conditional_t
+#include <utility> // std::forward, std::move, std::index_sequence
+
+
+namespace plf
+{
+
+
+struct soa_colony_limits // for use in block_capacity setting/getting functions and constructors
+{
+	size_t min, max;
+	constexpr soa_colony_limits(const size_t minimum, const size_t maximum) noexcept : min(minimum), max(maximum) {}
+};
+
+
+
+template <class allocator_type, class... field_types>
+class basic_soa_colony
+{
+	static_assert(sizeof...(field_types) != 0, "soa_colony requires at least one field type");
+
+public:
+	typedef std::tuple<field_types...>											row_type;
+	typedef std::tuple<field_types &...>										reference;
+	typedef std::tuple<const field_types &...>								const_reference;
+	typedef typename std::allocator_traits<allocator_type>::size_type			size_type;
+	typedef typename std::allocator_traits<allocator_type>::difference_type	difference_type;
+	typedef unsigned short																skipfield_type;
+
+	template <size_t column_index>
+	using field_type = std::tuple_element_t<column_index, row_type>;
+
+	static constexpr size_t number_of_fields = sizeof...(field_types);
+
+private:
+	struct group;
+
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<group>	group_allocator_type;
+	typedef typename std::allocator_traits<group_allocator_type>::pointer					group_pointer_type;
+
+	static constexpr size_t block_alignment = std::max({alignof(std::max_align_t), alignof(field_types)...});
+
+	// The unit in which group memory blocks are allocated - aligned so that every column can begin on a suitably-aligned address:
+	struct alignas(block_alignment) aligned_allocation_struct
+	{
+		unsigned char data[block_alignment];
+	};
+
+	typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<aligned_allocation_struct>	block_allocator_type;
+	typedef typename std::allocator_traits<block_allocator_type>::pointer											block_pointer_type;
+
+
+	static constexpr size_t round_up(const size_t value, const size_t alignment) noexcept
+	{
+		return ((value + alignment - 1) / alignment) * alignment;
+	}
+
+
+
+	// Byte offsets of each column, then the skipfield, then the free list links, within a group's memory block:
+	struct block_layout
+	{
+		size_t column_offsets[sizeof...(field_types)];
+		size_t skipfield_offset, free_links_offset, number_of_units;
+
+		explicit block_layout(const size_t capacity) noexcept
+		{
+			size_t offset = 0, column = 0;
+			((offset = round_up(offset, alignof(field_types)), column_offsets[column++] = offset, offset += sizeof(field_types) * capacity), ...);
+			skipfield_offset = round_up(offset, alignof(skipfield_type));
+			free_links_offset = skipfield_offset + ((capacity + 1) * sizeof(skipfield_type));
+			number_of_units = (free_links_offset + (capacity * 2 * sizeof(skipfield_type)) + sizeof(aligned_allocation_struct) - 1) / sizeof(aligned_allocation_struct);
+		}
+	};
+
+
+
+	struct group
+	{
+		block_pointer_type				block;
+		std::tuple<field_types *...>	columns;
+		skipfield_type					*skipfield;		// capacity + 1 nodes - the final node is always zero, as per colony
+		skipfield_type					*free_links;	// For the first node of each erased skipblock: [index * 2] is the index of the previous skipblock in the group's free list, [index * 2 + 1] is the index of the next
+		group_pointer_type				next_group, previous_group, erasures_list_next_group;
+		size_type						group_number;
+		skipfield_type					capacity, size, last_endpoint, free_list_head;	// last_endpoint is the index one-past the last used (erased or non-erased) slot
+
+
+		group(const block_pointer_type allocated_block, const skipfield_type elements_per_group, const group_pointer_type previous) noexcept:
+			block(allocated_block),
+			next_group(nullptr),
+			previous_group(previous),
+			erasures_list_next_group(nullptr),
+			group_number((previous == nullptr) ? 0 : previous->group_number + 1u),
+			capacity(elements_per_group),
+			size(0),
+			last_endpoint(0),
+			free_list_head(std::numeric_limits<skipfield_type>::max())
+		{
+			const block_layout layout(elements_per_group);
+			unsigned char * const bytes = reinterpret_cast<unsigned char *>(&*block);
+			set_columns(bytes, layout, std::index_sequence_for<field_types...>());
+			skipfield = reinterpret_cast<skipfield_type *>(bytes + layout.skipfield_offset);
+			free_links = reinterpret_cast<skipfield_type *>(bytes + layout.free_links_offset);
+			std::memset(static_cast<void *>(skipfield), 0, sizeof(skipfield_type) * (static_cast<size_t>(elements_per_group) + 1u));
+		}
+
+
+		template <size_t... column_indexes>
+		void set_columns(unsigned char * const bytes, const block_layout &layout, std::index_sequence<column_indexes...>) noexcept
+		{
+			((std::get<column_indexes>(columns) = reinterpret_cast<field_type<column_indexes> *>(bytes + layout.column_offsets[column_indexes])), ...);
+		}
+
+
+		void reset(const group_pointer_type previous) noexcept
+		{
+			next_group = nullptr;
+			previous_group = previous;
+			erasures_list_next_group = nullptr;
+			group_number = (previous == nullptr) ? 0 : previous->group_number + 1u;
+			size = 0;
+			last_endpoint = 0;
+			free_list_head = std::numeric_limits<skipfield_type>::max();
+			std::memset(static_cast<void *>(skipfield), 0, sizeof(skipfield_type) * (static_cast<size_t>(capacity) + 1u));
+		}
+	};
+
+
+
+public:
+
+	template <bool is_const> class soa_iterator
+	{
+	private:
+		group_pointer_type	group_pointer;
+		skipfield_type		index;
+
+		friend class basic_soa_colony;
+		template <bool> friend class soa_iterator;
+
+		soa_iterator(const group_pointer_type group_p, const skipfield_type element_index) noexcept: group_pointer(group_p), index(element_index) {}
+
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef typename basic_soa_colony::row_type	value_type;
+		typedef typename basic_soa_colony::difference_type	difference_type;
+		typedef std::conditional_t<is_const, typename basic_soa_colony::const_reference, typename basic_soa_colony::reference>	reference;
+		typedef void	pointer;
+
+		soa_iterator() noexcept: group_pointer(nullptr), index(0) {}
+
+		template <bool is_const_it = is_const, class = std::enable_if_t<is_const_it> >
+		soa_iterator(const soa_iterator<false> &source) noexcept: group_pointer(source.group_pointer), index(source.index) {}
+
+		soa_iterator(const soa_iterator &source) noexcept = default;
+		soa_iterator & operator = (const soa_iterator &source) noexcept = default;
+
+
+
+		// Returns a reference to the given field of the row this iterator points to:
+		template <size_t column_index>
+		inline std::conditional_t<is_const, const field_type<column_index> &, field_type<column_index> &> get() const noexcept
+		{
+			return std::get<column_index>(group_pointer->columns)[index];
+		}
+
+
+
+		// Returns a proxy reference - a tuple of references to every field of the row:
+		inline reference operator * () const noexcept
+		{
+			return make_reference(std::index_sequence_for<field_types...>());
+		}
+
+
+
+		soa_iterator & operator ++ () noexcept
+		{
+			assert(group_pointer != nullptr);
+			index = static_cast<skipfield_type>(index + 1u + group_pointer->skipfield[index + 1u]);
+
+			if (index == group_pointer->last_endpoint && group_pointer->next_group != nullptr)
+			{
+				group_pointer = group_pointer->next_group;
+				index = *(group_pointer->skipfield);
+			}
+
+			return *this;
+		}
+
+
+
+		inline soa_iterator operator ++ (int) noexcept
+		{
+			const soa_iterator copy(*this);
+			++*this;
+			return copy;
+		}
+
+
+
+		soa_iterator & operator -- () noexcept
+		{
+			assert(group_pointer != nullptr);
+
+			if (index != 0)
+			{
+				const skipfield_type skip = group_pointer->skipfield[index - 1u];
+
+				if (skip != index) // ie. not all preceding slots in the group are erased
+				{
+					index = static_cast<skipfield_type>(index - (skip + 1u));
+					return *this;
+				}
+			}
+
+			group_pointer = group_pointer->previous_group;
+			assert(group_pointer != nullptr); // ie. not already at begin()
+			index = static_cast<skipfield_type>(group_pointer->capacity - 1u - group_pointer->skipfield[group_pointer->capacity - 1u]); // Non-back groups are always filled to capacity
+			return *this;
+		}
+
+
+
+		inline soa_iterator operator -- (int) noexcept
+		{
+			const soa_iterator copy(*this);
+			--*this;
+			return copy;
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator == (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return group_pointer == rh.group_pointer && index == rh.index;
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator != (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(*this == rh);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator < (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return (group_pointer == rh.group_pointer) ? (index < rh.index) : (group_pointer->group_number < rh.group_pointer->group_number);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator > (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return rh < *this;
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator <= (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(rh < *this);
+		}
+
+
+
+		template <bool is_const_it>
+		inline bool operator >= (const soa_iterator<is_const_it> &rh) const noexcept
+		{
+			return !(*this < rh);
+		}
+
+
+
+	private:
+
+		template <size_t... column_indexes>
+		inline reference make_reference(std::index_sequence<column_indexes...>) const noexcept
+		{
+			return reference(std::get<column_indexes>(group_pointer->columns)[index]...);
+		}
+	};
+
+
+	typedef soa_iterator<false>	iterator;
+	typedef soa_iterator<true>		const_iterator;
+
+
+
+private:
+
+	group_allocator_type	group_allocator;
+	iterator					end_iterator, begin_iterator;
+	group_pointer_type	groups_with_erasures_list_head, unused_groups_head;
+	size_type				total_size, total_capacity;
+	skipfield_type			min_group_capacity, max_group_capacity;
+
+
+
+	static constexpr size_t default_min_block_capacity() noexcept
+	{
+		return 8;
+	}
+
+
+
+	static void check_capacities_conformance(const plf::soa_colony_limits capacities)
+	{
+		if (capacities.min < 2 || capacities.min > capacities.max || capacities.max > std::numeric_limits<skipfield_type>::max())
+		{
+			throw std::length_error("Supplied memory block capacities outside of allowable ranges");
+		}
+	}
+
+
+
+	group_pointer_type allocate_new_group(const skipfield_type elements_per_group, const group_pointer_type previous = nullptr)
+	{
+		block_allocator_type block_allocator(group_allocator);
+		const size_t number_of_units = block_layout(elements_per_group).number_of_units;
+		const block_pointer_type block = std::allocator_traits<block_allocator_type>::allocate(block_allocator, number_of_units);
+		group_pointer_type new_group;
+
+		try
+		{
+			new_group = std::allocator_traits<group_allocator_type>::allocate(group_allocator, 1);
+		}
+		catch (...)
+		{
+			std::allocator_traits<block_allocator_type>::deallocate(block_allocator, block, number_of_units);
+			throw;
+		}
+
+		std::allocator_traits<group_allocator_type>::construct(group_allocator, &*new_group, block, elements_per_group, previous);
+		return new_group;
+	}
+
+
+
+	void deallocate_group(const group_pointer_type the_group) noexcept
+	{
+		block_allocator_type block_allocator(group_allocator);
+		std::allocator_traits<block_allocator_type>::deallocate(block_allocator, the_group->block, block_layout(the_group->capacity).number_of_units);
+		std::allocator_traits<group_allocator_type>::destroy(group_allocator, &*the_group);
+		std::allocator_traits<group_allocator_type>::deallocate(group_allocator, the_group, 1);
+	}
+
+
+
+	template <size_t column_index>
+	void destroy_field(const group_pointer_type group_p, const skipfield_type index) noexcept
+	{
+		typedef field_type<column_index> column_type;
+
+		if constexpr (!std::is_trivially_destructible<column_type>::value)
+		{
+			typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<column_type> column_allocator_type;
+			column_allocator_type column_allocator(group_allocator);
+			std::allocator_traits<column_allocator_type>::destroy(column_allocator, std::get<column_index>(group_p->columns) + index);
+		}
+	}
+
+
+
+	template <size_t... column_indexes>
+	inline void destroy_row(const group_pointer_type group_p, const skipfield_type index, std::index_sequence<column_indexes...>) noexcept
+	{
+		(destroy_field<column_indexes>(group_p, index), ...);
+	}
+
+
+
+	inline void destroy_row(const group_pointer_type group_p, const skipfield_type index) noexcept
+	{
+		destroy_row(group_p, index, std::index_sequence_for<field_types...>());
+	}
+
+
+
+	// Constructs each field of a row in turn - if a field's construction throws, the already-constructed fields are destroyed before rethrowing:
+	template <size_t column_index, class first_argument_type, class... argument_types>
+	void construct_row(const group_pointer_type group_p, const skipfield_type index, first_argument_type &&first, argument_types &&... rest)
+	{
+		typedef field_type<column_index> column_type;
+		typedef typename std::allocator_traits<allocator_type>::template rebind_alloc<column_type> column_allocator_type;
+		column_allocator_type column_allocator(group_allocator);
+		std::allocator_traits<column_allocator_type>::construct(column_allocator, std::get<column_index>(group_p->columns) + index, std::forward<first_argument_type>(first));
+
+		if constexpr (sizeof...(argument_types) != 0)
+		{
+			try
+			{
+				construct_row<column_index + 1>(group_p, index, std::forward<argument_types>(rest)...);
+			}
+			catch (...)
+			{
+				destroy_field<column_index>(group_p, index);
+				throw;
+			}
+		}
+	}
+
+
+
+	void blank() noexcept
+	{
+		end_iterator = begin_iterator = iterator();
+		groups_with_erasures_list_head = unused_groups_head = nullptr;
+		total_size = total_capacity = 0;
+	}
+
+
+
+	void destroy_all_data() noexcept
+	{
+		if (begin_iterator.group_pointer != nullptr)
+		{
+			clear();
+			deallocate_group(begin_iterator.group_pointer);
+		}
+
+		trim();
+	}
+
+
+
+	// As per colony::update_skipblock - takes the first slot of the first skipblock in the head group of the groups-with-erasures list:
+	void update_skipblock(const group_pointer_type group_p, const skipfield_type index) noexcept
+	{
+		const skipfield_type new_value = static_cast<skipfield_type>(group_p->skipfield[index] - 1u);
+		const skipfield_type previous_free_list_index = group_p->free_links[index * 2u];
+
+		if (new_value != 0) // ie. skipblock was longer than one slot - its start moves forward by one slot
+		{
+			group_p->skipfield[index + new_value] = group_p->skipfield[index + 1u] = new_value;
+			++(group_p->free_list_head);
+
+			if (previous_free_list_index != std::numeric_limits<skipfield_type>::max())
+			{
+				group_p->free_links[previous_free_list_index * 2u + 1u] = group_p->free_list_head;
+			}
+
+			group_p->free_links[(index + 1u) * 2u] = previous_free_list_index;
+			group_p->free_links[(index + 1u) * 2u + 1u] = std::numeric_limits<skipfield_type>::max();
+		}
+		else
+		{
+			group_p->free_list_head = previous_free_list_index;
+
+			if (previous_free_list_index != std::numeric_limits<skipfield_type>::max())
+			{
+				group_p->free_links[previous_free_list_index * 2u + 1u] = std::numeric_limits<skipfield_type>::max();
+			}
+			else // remove this group from the list of groups with erasures
+			{
+				groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
+			}
+		}
+
+		group_p->skipfield[index] = 0;
+		++(group_p->size);
+		++total_size;
+
+		if (group_p == begin_iterator.group_pointer && index < begin_iterator.index)
+		{
+			begin_iterator.index = index;
+		}
+	}
+
+
+
+	void remove_from_groups_with_erasures_list(const group_pointer_type group_to_remove) noexcept
+	{
+		if (group_to_remove == groups_with_erasures_list_head)
+		{
+			groups_with_erasures_list_head = groups_with_erasures_list_head->erasures_list_next_group;
+			return;
+		}
+
+		group_pointer_type previous_group = groups_with_erasures_list_head, current_group = groups_with_erasures_list_head->erasures_list_next_group;
+
+		while (group_to_remove != current_group)
+		{
+			previous_group = current_group;
+			current_group = current_group->erasures_list_next_group;
+		}
+
+		previous_group->erasures_list_next_group = current_group->erasures_list_next_group;
+	}
+
+
+
+public:
+
+	// Constructors:
+
+	basic_soa_colony() noexcept(noexcept(allocator_type())):
+		group_allocator(allocator_type()),
+		groups_with_erasures_list_head(nullptr),
+		unused_groups_head(nullptr),
+		total_size(0),
+		total_capacity(0),
+		min_group_capacity(static_cast<skipfield_type>(default_min_block_capacity())),
+		max_group_capacity(std::numeric_limits<skipfield_type>::max())
+	{}
+
+
+
+	explicit basic_soa_colony(const plf::soa_colony_limits capacities, const allocator_type &alloc = allocator_type()):
+		group_allocator(alloc),
+		groups_with_erasures_list_head(nullptr),
+		unused_groups_head(nullptr),
+		total_size(0),
+		total_capacity(0),
+		min_group_capacity(static_cast<skipfield_type>(capacities.min)),
+		max_group_capacity(static_cast<skipfield_type>(capacities.max))
+	{
+		check_capacities_conformance(capacities);
+	}
+
+
+
+	explicit basic_soa_colony(const allocator_type &alloc) noexcept:
+		group_allocator(alloc),
+		groups_with_erasures_list_head(nullptr),
+		unused_groups_head(nullptr),
+		total_size(0),
+		total_capacity(0),
+		min_group_capacity(static_cast<skipfield_type>(default_min_block_capacity())),
+		max_group_capacity(std::numeric_limits<skipfield_type>::max())
+	{}
+
+
+
+	basic_soa_colony(const basic_soa_colony &source):
+		group_allocator(std::allocator_traits<group_allocator_type>::select_on_container_copy_construction(source.group_allocator)),
+		groups_with_erasures_list_head(nullptr),
+		unused_groups_head(nullptr),
+		total_size(0),
+		total_capacity(0),
+		min_group_capacity(source.min_group_capacity),
+		max_group_capacity(source.max_group_capacity)
+	{
+		try
+		{
+			for (const_iterator current = source.begin(); current != source.end(); ++current)
+			{
+				std::apply([this](const field_types &... fields) { insert(fields...); }, *current);
+			}
+		}
+		catch (...)
+		{
+			destroy_all_data();
+			throw;
+		}
+	}
+
+
+
+	basic_soa_colony(basic_soa_colony &&source) noexcept:
+		group_allocator(std::move(source.group_allocator)),
+		end_iterator(source.end_iterator),
+		begin_iterator(source.begin_iterator),
+		groups_with_erasures_list_head(source.groups_with_erasures_list_head),
+		unused_groups_head(source.unused_groups_head),
+		total_size(source.total_size),
+		total_capacity(source.total_capacity),
+		min_group_capacity(source.min_group_capacity),
+		max_group_capacity(source.max_group_capacity)
+	{
+		source.blank();
+	}
+
+
+
+	~basic_soa_colony() noexcept
+	{
+		destroy_all_data();
+	}
+
+
+
+	basic_soa_colony & operator = (const basic_soa_colony &source)
+	{
+		if (&source != this)
+		{
+			basic_soa_colony temp(source);
+			swap(temp);
+		}
+
+		return *this;
+	}
+
+
+
+	basic_soa_colony & operator = (basic_soa_colony &&source) noexcept
+	{
+		if (&source != this)
+		{
+			destroy_all_data();
+			group_allocator = std::move(source.group_allocator);
+			end_iterator = source.end_iterator;
+			begin_iterator = source.begin_iterator;
+			groups_with_erasures_list_head = source.groups_with_erasures_list_head;
+			unused_groups_head = source.unused_groups_head;
+			total_size = source.total_size;
+			total_capacity = source.total_capacity;
+			min_group_capacity = source.min_group_capacity;
+			max_group_capacity = source.max_group_capacity;
+			source.blank();
+		}
+
+		return *this;
+	}
+
+
+
+	// Iterators:
+
+	inline iterator begin() noexcept
+	{
+		return begin_iterator;
+	}
+
+
+
+	inline const_iterator begin() const noexcept
+	{
+		return begin_iterator;
+	}
+
+
+
+	inline iterator end() noexcept
+	{
+		return end_iterator;
+	}
+
+
+
+	inline const_iterator end() const noexcept
+	{
+		return end_iterator;
+	}
+
+
+
+	inline const_iterator cbegin() const noexcept
+	{
+		return begin_iterator;
+	}
+
+
+
+	inline const_iterator cend() const noexcept
+	{
+		return end_iterator;
+	}
+
+
+
+	// Insertion - takes one argument per field, each of which is used to construct that field. Reuses erased slots where available, as per colony:
+	template <class... argument_types>
+	iterator insert(argument_types &&... fields)
+	{
+		static_assert(sizeof...(argument_types) == sizeof...(field_types), "insert() requires one argument per field");
+
+		if (groups_with_erasures_list_head != nullptr) // Reuse the first slot of the most recently erased skipblock in the most recently erased-from group
+		{
+			const group_pointer_type group_p = groups_with_erasures_list_head;
+			const skipfield_type index = group_p->free_list_head;
+			construct_row<0>(group_p, index, std::forward<argument_types>(fields)...);
+			update_skipblock(group_p, index);
+			return iterator(group_p, index);
+		}
+
+		if (end_iterator.group_pointer == nullptr) // ie. empty, with no groups allocated
+		{
+			const group_pointer_type new_group = allocate_new_group(min_group_capacity);
+
+			try
+			{
+				construct_row<0>(new_group, 0, std::forward<argument_types>(fields)...);
+			}
+			catch (...)
+			{
+				deallocate_group(new_group);
+				throw;
+			}
+
+			new_group->size = new_group->last_endpoint = 1;
+			begin_iterator = iterator(new_group, 0);
+			end_iterator = iterator(new_group, 1);
+			total_size = 1;
+			total_capacity = new_group->capacity;
+			return begin_iterator;
+		}
+
+		group_pointer_type group_p = end_iterator.group_pointer;
+
+		if (group_p->last_endpoint == group_p->capacity) // Back group is full - add a new one, reusing a reserved group if possible
+		{
+			group_pointer_type new_group;
+
+			if (unused_groups_head != nullptr)
+			{
+				new_group = unused_groups_head;
+				construct_row<0>(new_group, 0, std::forward<argument_types>(fields)...);
+				unused_groups_head = new_group->next_group;
+				new_group->reset(group_p);
+			}
+			else
+			{
+				const skipfield_type new_group_size = (total_size < static_cast<size_type>(max_group_capacity)) ? static_cast<skipfield_type>((total_size < min_group_capacity) ? min_group_capacity : total_size) : max_group_capacity;
+				new_group = allocate_new_group(new_group_size, group_p);
+
+				try
+				{
+					construct_row<0>(new_group, 0, std::forward<argument_types>(fields)...);
+				}
+				catch (...)
+				{
+					deallocate_group(new_group);
+					throw;
+				}
+
+				total_capacity += new_group_size;
+			}
+
+			group_p->next_group = new_group;
+			new_group->size = new_group->last_endpoint = 1;
+			end_iterator = iterator(new_group, 1);
+			++total_size;
+			return iterator(new_group, 0);
+		}
+
+		const skipfield_type index = group_p->last_endpoint;
+		construct_row<0>(group_p, index, std::forward<argument_types>(fields)...);
+		++(group_p->size);
+		end_iterator.index = ++(group_p->last_endpoint);
+		++total_size;
+		return iterator(group_p, index);
+	}
+
+
+
+	// Erases the row pointed to by it, returning an iterator to the following row. Only iterators to the erased row are invalidated. The skipfield and free list are updated as per colony::erase:
+	iterator erase(const const_iterator it) noexcept
+	{
+		assert(total_size != 0 && it.group_pointer != nullptr && !(it.group_pointer == end_iterator.group_pointer && it.index == end_iterator.index));
+
+		const group_pointer_type group_p = it.group_pointer;
+		const skipfield_type index = it.index;
+		skipfield_type * const skipfield = group_p->skipfield;
+		destroy_row(group_p, index);
+		--total_size;
+
+		if (--(group_p->size) != 0) // ie. group is not empty yet, don't remove it
+		{
+			const bool preceding_erased = index != 0 && skipfield[index - 1u] != 0, following_erased = skipfield[index + 1u] != 0;
+			skipfield_type update_value = 1;
+
+			if (!(preceding_erased || following_erased)) // new skipblock, add it to the free list
+			{
+				skipfield[index] = 1;
+
+				if (group_p->free_list_head != std::numeric_limits<skipfield_type>::max()) // ie. if this group already has some erased elements
+				{
+					group_p->free_links[group_p->free_list_head * 2u + 1u] = index;
+				}
+				else
+				{
+					group_p->erasures_list_next_group = groups_with_erasures_list_head; // add it to the groups-with-erasures list
+					groups_with_erasures_list_head = group_p;
+				}
+
+				group_p->free_links[index * 2u] = group_p->free_list_head;
+				group_p->free_links[index * 2u + 1u] = std::numeric_limits<skipfield_type>::max();
+				group_p->free_list_head = index;
+			}
+			else if (preceding_erased && !following_erased) // extend the preceding skipblock - its free list node is unchanged
+			{
+				const skipfield_type value = static_cast<skipfield_type>(skipfield[index - 1u] + 1u);
+				skipfield[index - skipfield[index - 1u]] = skipfield[index] = value;
+			}
+			else if (following_erased && !preceding_erased) // the following skipblock starts at this slot instead - move its free list node here
+			{
+				const skipfield_type following_value = static_cast<skipfield_type>(skipfield[index + 1u] + 1u);
+				skipfield[index + following_value - 1u] = skipfield[index] = following_value;
+
+				const skipfield_type following_previous = group_p->free_links[(index + 1u) * 2u], following_next = group_p->free_links[(index + 1u) * 2u + 1u];
+				group_p->free_links[index * 2u] = following_previous;
+				group_p->free_links[index * 2u + 1u] = following_next;
+
+				if (following_previous != std::numeric_limits<skipfield_type>::max())
+				{
+					group_p->free_links[following_previous * 2u + 1u] = index;
+				}
+
+				if (following_next != std::numeric_limits<skipfield_type>::max())
+				{
+					group_p->free_links[following_next * 2u] = index;
+				}
+				else
+				{
+					group_p->free_list_head = index;
+				}
+
+				update_value = following_value;
+			}
+			else // join the preceding and following skipblocks, removing the following skipblock's free list node
+			{
+				const skipfield_type preceding_value = skipfield[index - 1u], following_value = static_cast<skipfield_type>(skipfield[index + 1u] + 1u);
+				skipfield[index - preceding_value] = skipfield[index + following_value - 1u] = static_cast<skipfield_type>(preceding_value + following_value);
+
+				const skipfield_type following_previous = group_p->free_links[(index + 1u) * 2u], following_next = group_p->free_links[(index + 1u) * 2u + 1u];
+
+				if (following_previous != std::numeric_limits<skipfield_type>::max())
+				{
+					group_p->free_links[following_previous * 2u + 1u] = following_next;
+				}
+
+				if (following_next != std::numeric_limits<skipfield_type>::max())
+				{
+					group_p->free_links[following_next * 2u] = following_previous;
+				}
+				else
+				{
+					group_p->free_list_head = following_previous;
+				}
+
+				update_value = following_value;
+			}
+
+			iterator return_iterator(group_p, static_cast<skipfield_type>(index + update_value));
+
+			if (return_iterator.index == group_p->last_endpoint && group_p->next_group != nullptr)
+			{
+				return_iterator.group_pointer = group_p->next_group;
+				return_iterator.index = *(return_iterator.group_pointer->skipfield);
+			}
+
+			if (group_p == begin_iterator.group_pointer && index == begin_iterator.index)
+			{
+				begin_iterator = return_iterator;
+			}
+
+			return return_iterator;
+		}
+
+		// else: group is empty, remove it
+		if (group_p->free_list_head != std::numeric_limits<skipfield_type>::max())
+		{
+			remove_from_groups_with_erasures_list(group_p);
+		}
+
+		const group_pointer_type next_group = group_p->next_group, previous_group = group_p->previous_group;
+
+		if (next_group == nullptr && previous_group == nullptr) // ie. only group - reset it rather than deallocating
+		{
+			group_p->reset(nullptr);
+			begin_iterator = end_iterator = iterator(group_p, 0);
+			return end_iterator;
+		}
+
+		if (previous_group == nullptr)
+		{
+			next_group->previous_group = nullptr;
+			begin_iterator = iterator(next_group, *(next_group->skipfield));
+		}
+		else
+		{
+			previous_group->next_group = next_group;
+
+			if (next_group != nullptr)
+			{
+				next_group->previous_group = previous_group;
+			}
+			else
+			{
+				end_iterator = iterator(previous_group, previous_group->last_endpoint);
+			}
+		}
+
+		if (next_group == nullptr) // Retain the back group as reserved capacity, as per colony, to avoid reallocation when insertion and erasure alternate around a group boundary
+		{
+			group_p->next_group = unused_groups_head;
+			unused_groups_head = group_p;
+			return end_iterator;
+		}
+
+		total_capacity -= group_p->capacity;
+		deallocate_group(group_p);
+		return iterator(next_group, *(next_group->skipfield));
+	}
+
+
+
+	// Range erase - erases each row in turn:
+	iterator erase(const_iterator first, const const_iterator last) noexcept
+	{
+		if (last == end_iterator) // end() can move to a previous group as groups are emptied
+		{
+			while (first != end_iterator)
+			{
+				first = erase(first);
+			}
+
+			return end_iterator;
+		}
+
+		while (first != last)
+		{
+			first = erase(first);
+		}
+
+		return iterator(last.group_pointer, last.index);
+	}
+
+
+
+private:
+
+	// Used by for_each - the column pointers are passed in as parameters so that the compiler knows they are loop-invariant:
+	template <class function_type, class... column_types>
+	static void for_each_in_group(const group_pointer_type group_p, function_type &function, column_types * const... columns)
+	{
+		if (group_p->free_list_head == std::numeric_limits<skipfield_type>::max()) // ie. no erasures - a plain indexed loop over each column array, which the compiler can vectorize
+		{
+			for (size_t index = 0, end = group_p->last_endpoint; index != end; ++index)
+			{
+				function(columns[index]...);
+			}
+		}
+		else
+		{
+			const skipfield_type * const skipfield = group_p->skipfield;
+
+			for (size_t index = *skipfield, end = group_p->last_endpoint; index != end;)
+			{
+				function(columns[index]...);
+				++index;
+				index += skipfield[index];
+			}
+		}
+	}
+
+
+
+public:
+
+	// Calls function(field, ...) for each non-erased row, passing only the fields of the given columns, in order of column_indexes:
+	template <size_t... column_indexes, class function_type>
+	void for_each(function_type function)
+	{
+		static_assert(sizeof...(column_indexes) != 0, "for_each requires at least one column index");
+
+		for (group_pointer_type current = begin_iterator.group_pointer; current != nullptr; current = current->next_group)
+		{
+			for_each_in_group(current, function, std::get<column_indexes>(current->columns)...);
+		}
+	}
+
+
+
+	template <size_t... column_indexes, class function_type>
+	void for_each(function_type function) const
+	{
+		const_cast<basic_soa_colony *>(this)->template for_each<column_indexes...>([&function](const field_type<column_indexes> &... fields) { function(fields...); });
+	}
+
+
+
+	// Capacity and size:
+
+	[[nodiscard]] inline bool empty() const noexcept
+	{
+		return total_size == 0;
+	}
+
+
+
+	inline size_type size() const noexcept
+	{
+		return total_size;
+	}
+
+
+
+	inline size_type capacity() const noexcept
+	{
+		return total_capacity;
+	}
+
+
+
+	size_type memory() const noexcept
+	{
+		size_type memory_use = sizeof(*this);
+
+		for (group_pointer_type current = begin_iterator.group_pointer; current != nullptr; current = current->next_group)
+		{
+			memory_use += sizeof(group) + (block_layout(current->capacity).number_of_units * sizeof(aligned_allocation_struct));
+		}
+
+		for (group_pointer_type current = unused_groups_head; current != nullptr; current = current->next_group)
+		{
+			memory_use += sizeof(group) + (block_layout(current->capacity).number_of_units * sizeof(aligned_allocation_struct));
+		}
+
+		return memory_use;
+	}
+
+
+
+	inline plf::soa_colony_limits block_limits() const noexcept
+	{
+		return plf::soa_colony_limits(static_cast<size_t>(min_group_capacity), static_cast<size_t>(max_group_capacity));
+	}
+
+
+
+	inline allocator_type get_allocator() const noexcept
+	{
+		return allocator_type(group_allocator);
+	}
+
+
+
+	// Destroys all rows. Groups other than the first are retained as reserved capacity:
+	void clear() noexcept
+	{
+		if (begin_iterator.group_pointer == nullptr)
+		{
+			return;
+		}
+
+		if constexpr (!(std::is_trivially_destructible<field_types>::value && ...))
+		{
+			for (iterator current = begin_iterator; current != end_iterator; ++current)
+			{
+				destroy_row(current.group_pointer, current.index);
+			}
+		}
+
+		const group_pointer_type first_group = begin_iterator.group_pointer;
+
+		if (first_group->next_group != nullptr)
+		{
+			end_iterator.group_pointer->next_group = unused_groups_head;
+			unused_groups_head = first_group->next_group;
+		}
+
+		first_group->reset(nullptr);
+		begin_iterator = end_iterator = iterator(first_group, 0);
+		groups_with_erasures_list_head = nullptr;
+		total_size = 0;
+	}
+
+
+
+	// Deallocates reserved groups:
+	void trim() noexcept
+	{
+		while (unused_groups_head != nullptr)
+		{
+			const group_pointer_type next_group = unused_groups_head->next_group;
+			total_capacity -= unused_groups_head->capacity;
+			deallocate_group(unused_groups_head);
+			unused_groups_head = next_group;
+		}
+	}
+
+
+
+	void swap(basic_soa_colony &source) noexcept
+	{
+		std::swap(group_allocator, source.group_allocator);
+		std::swap(end_iterator, source.end_iterator);
+		std::swap(begin_iterator, source.begin_iterator);
+		std::swap(groups_with_erasures_list_head, source.groups_with_erasures_list_head);
+		std::swap(unused_groups_head, source.unused_groups_head);
+		std::swap(total_size, source.total_size);
+		std::swap(total_capacity, source.total_capacity);
+		std::swap(min_group_capacity, source.min_group_capacity);
+		std::swap(max_group_capacity, source.max_group_capacity);
+	}
+
+
+
+	friend inline void swap(basic_soa_colony &a, basic_soa_colony &b) noexcept
+	{
+		a.swap(b);
+	}
+};
+
+
+
+template <class... field_types>
+using soa_colony = basic_soa_colony<std::allocator<unsigned char>, field_types...>;
+
+
+} // plf namespace
+
+#endif // PLF_SOA_COLONY_H
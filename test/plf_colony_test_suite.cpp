@@ -1,4 +1,5 @@
 #define PLF_COLONY_TEST_DEBUG
+#define PLF_COLONY_ALLOCATION_COUNTERS
 
 #if defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
 	#if _MSC_VER >= 1600
@@ -80,9 +81,22 @@
 	#include <utility> // std::move
 #endif
 
+#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT // defined by the build system when a parallel backend is available
+	#include <execution> // std::execution::par
+#endif
+
+#ifdef PLF_TEST_THREAD_SUPPORT // defined by the build system when a threads library is available
+	#include <thread> // std::thread
+#endif
+
 #include "plf_rand.h"
 #include "plf_colony.h"
 
+#if defined(PLF_TEST_MOVE_SEMANTICS_SUPPORT) && defined(PLF_TEST_TYPE_TRAITS_SUPPORT)
+	#include "plf_colony_block_pool.h"
+	#include "plf_colony_huge_page.h"
+#endif
+
 
 
 void message(const char *message_text)
@@ -187,6 +201,324 @@ struct small_struct_non_trivial
 
 
 
+struct padded_struct // 256 bytes, for for_each_prefetched() tests
+{
+	int number;
+	char padding[252];
+};
+
+
+
+struct padded_summer // for for_each_prefetched() tests
+{
+	long long *total;
+	unsigned int *number_of_elements;
+
+	padded_summer(long long *sum, unsigned int *elements): total(sum), number_of_elements(elements) {}
+
+	void operator() (const padded_struct &element) const
+	{
+		*total += element.number;
+		++*number_of_elements;
+	}
+};
+
+
+
+struct block_summer // for for_each_block() tests
+{
+	int *total;
+	unsigned int *number_of_elements, *number_of_blocks;
+
+	block_summer(int *sum, unsigned int *elements, unsigned int *blocks): total(sum), number_of_elements(elements), number_of_blocks(blocks) {}
+
+	void operator() (const int *block, const size_t count) const
+	{
+		for (size_t index = 0; index != count; ++index)
+		{
+			*total += block[index];
+		}
+
+		*number_of_elements += static_cast<unsigned int>(count);
+		++*number_of_blocks;
+	}
+};
+
+
+
+struct snapshot_writer // for snapshot() tests - appends to a byte buffer
+{
+	std::vector<char> *buffer;
+
+	explicit snapshot_writer(std::vector<char> *output): buffer(output) {}
+
+	void operator() (const void *data, const size_t size) const
+	{
+		buffer->insert(buffer->end(), static_cast<const char *>(data), static_cast<const char *>(data) + size);
+	}
+};
+
+
+struct snapshot_reader // for restore() tests - reads from a byte buffer, throwing if the buffer is exhausted
+{
+	const std::vector<char> *buffer;
+	size_t *position;
+
+	snapshot_reader(const std::vector<char> *input, size_t *read_position): buffer(input), position(read_position) {}
+
+	void operator() (void *data, const size_t size) const
+	{
+		if (*position + size > buffer->size())
+		{
+			throw 0;
+		}
+
+		std::copy(buffer->begin() + static_cast<std::ptrdiff_t>(*position), buffer->begin() + static_cast<std::ptrdiff_t>(*position + size), static_cast<char *>(data));
+		*position += size;
+	}
+};
+
+
+struct erase_if_test_predicate // for member erase_if() tests - scattered erasures, plus a long run covering whole groups
+{
+	bool operator() (const int value) const
+	{
+		return value % 5 == 0 || (value >= 3000 && value < 8000);
+	}
+};
+
+
+struct throwing_predicate // for member erase_if() exception test - erases even numbers, throws on the 600th call
+{
+	int *calls;
+
+	explicit throwing_predicate(int *call_count): calls(call_count) {}
+
+	bool operator() (const int value) const
+	{
+		if (++*calls == 600)
+		{
+			throw 600;
+		}
+
+		return (value & 1) == 0;
+	}
+};
+
+
+struct throwing_assignment // for sort_by_key() exception test - assignment throws once the shared countdown reaches zero
+{
+	int value;
+	int *countdown;
+
+	throwing_assignment(const int new_value, int *new_countdown): value(new_value), countdown(new_countdown) {}
+	throwing_assignment(const throwing_assignment &source): value(source.value), countdown(source.countdown) {}
+
+	throwing_assignment & operator = (const throwing_assignment &source)
+	{
+		if (--*countdown == 0)
+		{
+			throw 0;
+		}
+
+		value = source.value;
+		return *this;
+	}
+};
+
+
+struct relocation_recorder // for consolidate_step() tests - updates a table of element locations indexed by element value, counting relocations whose old location does not match the table
+{
+	std::vector<int *> *locations;
+	int *mismatches;
+
+	relocation_recorder(std::vector<int *> *location_table, int *mismatch_count): locations(location_table), mismatches(mismatch_count) {}
+
+	void operator() (int *old_location, int *new_location) const
+	{
+		if ((*locations)[static_cast<unsigned int>(*new_location)] != old_location)
+		{
+			++*mismatches;
+		}
+
+		(*locations)[static_cast<unsigned int>(*new_location)] = new_location;
+	}
+};
+
+
+
+struct cold_record // for cold value tests
+{
+	int id;
+	double weight;
+};
+
+
+
+template <class cold_colony_type>
+bool cold_values_match(cold_colony_type &colony) // checks that every element's cold value still belongs to it
+{
+	for (typename cold_colony_type::iterator it = colony.begin(); it != colony.end(); ++it)
+	{
+		if (colony.cold(it).id != *it || colony.cold(it).weight != *it * 0.5)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+plf::colony_growth_state last_growth_state; // for growth policy tests
+
+size_t recording_growth_policy(const plf::colony_growth_state &state)
+{
+	last_growth_state = state;
+	return 50;
+}
+
+
+
+template <class colony_type>
+size_t churn_memory(colony_type &i_colony) // Fills the colony, then repeatedly erases and re-inserts elements with slow net growth, returning memory() at the end
+{
+	for (int count = 0; count != 20000; ++count)
+	{
+		i_colony.insert(count);
+	}
+
+	i_colony.shrink_to_fit();
+
+	for (int round = 0; round != 100; ++round)
+	{
+		int number_erased = 0;
+
+		for (typename colony_type::iterator it = i_colony.begin(); it != i_colony.end() && number_erased != 500;)
+		{
+			if (*it % 37 == round % 37)
+			{
+				it = i_colony.erase(it);
+				++number_erased;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		for (int count = 0; count != 505; ++count)
+		{
+			i_colony.insert(count);
+		}
+	}
+
+	return i_colony.memory();
+}
+
+
+
+
+
+template <class colony_type>
+bool skipfield_scanning_test(colony_type &i_colony) // Checks iterator arithmetic and range-erase over a heavily fragmented colony against a vector holding the same sequence
+{
+	std::vector<int> values;
+
+	for (int count = 0; count != 20000; ++count)
+	{
+		i_colony.insert(count);
+	}
+
+	for (typename colony_type::iterator it = i_colony.begin(); it != i_colony.end();)
+	{
+		if ((plf::rand() & 31) == 0) // Occasional long skipblocks
+		{
+			typename colony_type::iterator last = it;
+			advance(last, static_cast<int>(plf::rand() & 63) + 1);
+			it = i_colony.erase(it, last);
+		}
+		else
+		{
+			it = ((plf::rand() & 3) == 0) ? i_colony.erase(it) : ++it;
+		}
+	}
+
+	values.assign(i_colony.begin(), i_colony.end());
+
+	for (unsigned int test = 0; test != 200; ++test)
+	{
+		const int size = static_cast<int>(values.size());
+		const int start = static_cast<int>(plf::rand() % static_cast<unsigned int>(size)), offset = static_cast<int>(plf::rand() % static_cast<unsigned int>(size));
+		typename colony_type::iterator it = i_colony.begin();
+
+		advance(it, start);
+
+		if (*it != values[static_cast<unsigned int>(start)] || distance(i_colony.begin(), it) != start)
+		{
+			return false;
+		}
+
+		advance(it, offset);
+
+		if ((start + offset >= size) ? it != i_colony.end() : *it != values[static_cast<unsigned int>(start + offset)])
+		{
+			return false;
+		}
+
+		advance(it, -offset);
+
+		if (*it != values[static_cast<unsigned int>((start + offset >= size) ? size - offset : start)])
+		{
+			return false;
+		}
+
+		typename colony_type::reverse_iterator r_it = i_colony.rbegin();
+		advance(r_it, start);
+
+		if (*r_it != values[static_cast<unsigned int>(size - 1 - start)] || distance(r_it, i_colony.rend()) != size - start)
+		{
+			return false;
+		}
+
+		advance(r_it, offset);
+
+		if ((start + offset >= size) ? r_it != i_colony.rend() : *r_it != values[static_cast<unsigned int>(size - 1 - (start + offset))])
+		{
+			return false;
+		}
+	}
+
+	while (values.size() > 100)
+	{
+		const unsigned int first = plf::rand() % static_cast<unsigned int>(values.size()), last = first + (plf::rand() % static_cast<unsigned int>(values.size() - first));
+		typename colony_type::iterator it1 = i_colony.begin(), it2;
+
+		advance(it1, static_cast<int>(first));
+		it2 = it1;
+		advance(it2, static_cast<int>(last - first));
+
+		i_colony.erase(it1, it2);
+		values.erase(values.begin() + first, values.begin() + last);
+
+		if (i_colony.size() != values.size() || !std::equal(values.begin(), values.end(), i_colony.begin()))
+		{
+			return false;
+		}
+
+		for (typename colony_type::iterator it = i_colony.begin(); it != i_colony.end();)
+		{
+			it = ((plf::rand() & 15) == 0) ? i_colony.erase(it) : ++it;
+		}
+
+		values.assign(i_colony.begin(), i_colony.end());
+	}
+
+	return true;
+}
+
+
 
 int main()
 {
@@ -1213,6 +1545,88 @@ int main()
 			}
 
 			failpass("Greater-than sort test", sorted);
+
+			#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT
+				for (colony<int>::iterator current = i_colony.begin(); current != i_colony.end();)
+				{
+					current = ((plf::rand() & 3) == 0) ? i_colony.erase(current) : ++current;
+				}
+
+				const int total = std::accumulate(i_colony.begin(), i_colony.end(), 0);
+
+				i_colony.sort(std::execution::par, std::less<int>());
+				failpass("Parallel less-than sort test", std::is_sorted(i_colony.begin(), i_colony.end()) && std::accumulate(i_colony.begin(), i_colony.end(), 0) == total);
+
+				i_colony.sort(std::execution::par_unseq, std::greater<int>());
+				failpass("Parallel greater-than sort test", std::is_sorted(i_colony.begin(), i_colony.end(), std::greater<int>()) && std::accumulate(i_colony.begin(), i_colony.end(), 0) == total);
+			#endif
+
+			#ifdef PLF_TEST_TYPE_TRAITS_SUPPORT
+				for (colony<int>::iterator current = i_colony.begin(); current != i_colony.end(); ++current)
+				{
+					*current -= 32768; // Include negative keys
+				}
+
+				i_colony.sort_by_key([](const int value) { return value; });
+				failpass("Integer sort_by_key test", std::is_sorted(i_colony.begin(), i_colony.end()));
+
+				i_colony.sort_by_key([](const int value) { return -static_cast<double>(value) * 0.5; });
+				failpass("Floating-point sort_by_key test", std::is_sorted(i_colony.begin(), i_colony.end(), std::greater<int>()));
+
+				i_colony.sort_by_key([](const int value) { return static_cast<unsigned char>(value & 255); });
+				bool stable = true;
+
+				for (colony<int>::iterator current = i_colony.begin(), next_element = ++i_colony.begin(); next_element != i_colony.end(); ++current, ++next_element)
+				{
+					if ((*current & 255) > (*next_element & 255) || ((*current & 255) == (*next_element & 255) && *current < *next_element)) // Equal keys must remain in the previous (descending) order
+					{
+						stable = false;
+						break;
+					}
+				}
+
+				failpass("Stable sort_by_key test", stable);
+
+				i_colony.sort_by_key([](const int value) { return std::pair<int, int>(value & 15, value); });
+				failpass("Non-arithmetic key sort_by_key test", std::is_sorted(i_colony.begin(), i_colony.end(), [](const int a, const int b) { return std::make_pair(a & 15, a) < std::make_pair(b & 15, b); }));
+
+				const std::vector<int> before(i_colony.begin(), i_colony.end());
+				int calls = 0;
+				bool thrown = false;
+
+				try
+				{
+					i_colony.sort_by_key([&calls](const int value) { if (++calls == 600) throw 600; return value; });
+				}
+				catch (int)
+				{
+					thrown = true;
+				}
+
+				failpass("Throwing key extractor sort_by_key test", thrown && i_colony.size() == before.size() && std::equal(before.begin(), before.end(), i_colony.begin()));
+
+				colony<throwing_assignment> t_colony;
+				int countdown = -1;
+
+				for (int count = 0; count != 1000; ++count)
+				{
+					t_colony.insert(throwing_assignment(1000 - count, &countdown));
+				}
+
+				countdown = 100;
+				thrown = false;
+
+				try
+				{
+					t_colony.sort_by_key([](const throwing_assignment &element) { return element.value; });
+				}
+				catch (int)
+				{
+					thrown = true;
+				}
+
+				failpass("Throwing element assignment sort_by_key test", thrown && t_colony.size() == 1000);
+			#endif
 		}
 
 
@@ -1962,36 +2376,94 @@ int main()
 
 			failpass("erase_if test",	static_cast<int>(i_colony.size()) == 500);
 
-		}
-
-		{
-			title2("data() tests");
+			i_colony.clear();
 
-			colony<int> i_colony(10000, 5);
+			for (int count = 0; count != 20000; ++count)
+			{
+				i_colony.insert(count);
+			}
 
-			int sum1 = 0, sum2 = 0, range1 = 0, range2 = 0;
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				it = ((plf::rand() & 7) == 0) ? i_colony.erase(it) : ++it;
+			}
 
+			std::vector<int> expected;
 
-			// Erase half of all elements and sum the rest:
 			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it)
 			{
-				it = i_colony.erase(it);
-				sum1 += *it;
-				++range1;
+				if (!erase_if_test_predicate()(*it))
+				{
+					expected.push_back(*it);
+				}
 			}
 
+			const unsigned int original_size = static_cast<unsigned int>(i_colony.size());
 
-			colony<int>::colony_data *data = i_colony.data();
+			failpass("Member erase_if count test", i_colony.erase_if(erase_if_test_predicate()) == original_size - expected.size());
+			failpass("Member erase_if result test", i_colony.size() == expected.size() && std::equal(expected.begin(), expected.end(), i_colony.begin()) && std::equal(expected.rbegin(), expected.rend(), i_colony.rbegin()) && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == expected.size());
 
-			// Manually sum using raw memory blocks:
-			for (unsigned int block_num = 0; block_num != data->number_of_blocks; ++block_num)
+			for (int count = 0; count != 5000; ++count)
 			{
-				colony<int>::aligned_element_type *current_element = data->block_pointers[block_num];
-				const unsigned char *bitfield_location = data->bitfield_pointers[block_num];
-				const size_t capacity = data->block_capacities[block_num];
+				i_colony.insert(-1);
+			}
 
-				size_t char_index = 0;
-				unsigned char offset = 0;
+			failpass("Reinsertion after member erase_if test", std::count(i_colony.begin(), i_colony.end(), -1) == 5000 && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == i_colony.size());
+
+			const unsigned int size_before = static_cast<unsigned int>(i_colony.size());
+
+			#ifdef PLF_TEST_MOVE_SEMANTICS_SUPPORT
+				failpass("Member erase_if all elements test", i_colony.erase_if(std::bind(std::greater<int>(), std::placeholders::_1, -2)) == size_before && i_colony.empty() && i_colony.begin() == i_colony.end());
+			#else
+				failpass("Member erase_if all elements test", i_colony.erase_if(std::bind2nd(std::greater<int>(), -2)) == size_before && i_colony.empty() && i_colony.begin() == i_colony.end());
+			#endif
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			int calls = 0;
+
+			try
+			{
+				i_colony.erase_if(throwing_predicate(&calls));
+			}
+			catch (int)
+			{}
+
+			failpass("Member erase_if exception test", i_colony.size() == 700 && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == 700 && *(i_colony.begin()) == 1 && std::count(i_colony.begin(), i_colony.end(), 598) == 0 && std::count(i_colony.begin(), i_colony.end(), 600) == 1);
+
+		}
+
+		{
+			title2("data() tests");
+
+			colony<int> i_colony(10000, 5);
+
+			int sum1 = 0, sum2 = 0, range1 = 0, range2 = 0;
+
+
+			// Erase half of all elements and sum the rest:
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it)
+			{
+				it = i_colony.erase(it);
+				sum1 += *it;
+				++range1;
+			}
+
+
+			colony<int>::colony_data *data = i_colony.data();
+
+			// Manually sum using raw memory blocks:
+			for (unsigned int block_num = 0; block_num != data->number_of_blocks; ++block_num)
+			{
+				colony<int>::aligned_element_type *current_element = data->block_pointers[block_num];
+				const unsigned char *bitfield_location = data->bitfield_pointers[block_num];
+				const size_t capacity = data->block_capacities[block_num];
+
+				size_t char_index = 0;
+				unsigned char offset = 0;
 
 				for (size_t index = 0; index != capacity; ++index, ++current_element)
 				{
@@ -2013,6 +2485,1137 @@ int main()
 
 			failpass("Manual summing pass over elements obtained from data()", (sum1 == sum2) && (range1 == range2));
 		}
+
+		#ifdef PLF_TEST_TYPE_TRAITS_SUPPORT
+		{
+			title2("Snapshot tests");
+
+			colony<int> i_colony(plf::colony_limits(50, 1000));
+
+			for (int count = 0; count != 30000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				it = ((plf::rand() & 3) == 0) ? i_colony.erase(it) : ++it;
+			}
+
+			std::vector<char> buffer;
+			i_colony.snapshot(snapshot_writer(&buffer));
+
+			colony<int> i_colony2;
+			i_colony2.insert(5, 5);
+			size_t position = 0;
+			i_colony2.restore(snapshot_reader(&buffer, &position));
+
+			failpass("Restore test", position == buffer.size() && i_colony2 == i_colony && i_colony2.capacity() >= i_colony2.size() && i_colony2.block_limits().min == 50 && i_colony2.block_limits().max == 1000);
+			failpass("Restored reverse iteration test", std::equal(i_colony.rbegin(), i_colony.rend(), i_colony2.rbegin()) && static_cast<unsigned int>(distance(i_colony2.begin(), i_colony2.end())) == i_colony2.size());
+
+			for (int count = 0; count != 10000; ++count) // Reuses the restored free lists
+			{
+				i_colony.insert(count);
+				i_colony2.insert(count);
+			}
+
+			failpass("Insertion into restored colony test", i_colony2 == i_colony);
+
+			i_colony2.erase(next(i_colony2.begin(), 100), prev(i_colony2.end(), 100));
+			failpass("Erasure from restored colony test", i_colony2.size() == 200 && static_cast<unsigned int>(distance(i_colony2.begin(), i_colony2.end())) == 200);
+
+			buffer.clear();
+			i_colony2.snapshot(snapshot_writer(&buffer)); // Group numbers are non-contiguous after the range-erase
+			colony<int> i_colony3;
+			position = 0;
+			i_colony3.restore(snapshot_reader(&buffer, &position));
+
+			failpass("Snapshot after range-erase test", position == buffer.size() && i_colony3 == i_colony2);
+
+			const std::vector<int> before(i_colony2.begin(), i_colony2.end());
+			buffer.resize(buffer.size() / 2);
+			position = 0;
+			bool thrown = false;
+
+			try
+			{
+				i_colony2.restore(snapshot_reader(&buffer, &position));
+			}
+			catch (int)
+			{
+				thrown = true;
+			}
+
+			failpass("Truncated snapshot test", thrown && std::equal(before.begin(), before.end(), i_colony2.begin()) && i_colony2.size() == before.size());
+
+			buffer[0] = 'x';
+			position = 0;
+			thrown = false;
+
+			try
+			{
+				i_colony2.restore(snapshot_reader(&buffer, &position));
+			}
+			catch (std::invalid_argument &)
+			{
+				thrown = true;
+			}
+
+			failpass("Invalid snapshot test", thrown && i_colony2.size() == before.size());
+
+			colony<int> small_colony(plf::colony_limits(8, 8));
+
+			for (int count = 0; count != 8; ++count)
+			{
+				small_colony.insert(count);
+			}
+
+			small_colony.erase(next(small_colony.begin(), 2), next(small_colony.begin(), 4));
+			std::vector<char> small_buffer;
+			small_colony.snapshot(snapshot_writer(&small_buffer));
+
+			// Offsets from the end of the snapshot of the single group's capacity, free list head and skipblock end node, followed by their corrupted values:
+			const size_t corrupt_offsets[3] = {56, 50, 10};
+			const unsigned short corrupt_values[3] = {9, 5, 1};
+			bool all_thrown = true;
+
+			for (unsigned int corruption = 0; corruption != 3; ++corruption)
+			{
+				std::vector<char> corrupt_buffer(small_buffer);
+				std::memcpy(&corrupt_buffer[corrupt_buffer.size() - corrupt_offsets[corruption]], &corrupt_values[corruption], sizeof(unsigned short));
+				position = 0;
+				thrown = false;
+
+				try
+				{
+					i_colony2.restore(snapshot_reader(&corrupt_buffer, &position));
+				}
+				catch (std::invalid_argument &)
+				{
+					thrown = true;
+				}
+
+				all_thrown = all_thrown && thrown;
+			}
+
+			position = 0;
+			i_colony3.restore(snapshot_reader(&small_buffer, &position));
+
+			failpass("Inconsistent snapshot contents test", all_thrown && i_colony2.size() == before.size() && i_colony3 == small_colony);
+
+			colony<int> empty_colony;
+			buffer.clear();
+			empty_colony.snapshot(snapshot_writer(&buffer));
+			position = 0;
+			i_colony2.restore(snapshot_reader(&buffer, &position));
+
+			failpass("Empty snapshot test", i_colony2.empty() && i_colony2.begin() == i_colony2.end());
+
+			i_colony2.insert(1);
+			failpass("Insertion into restored empty colony test", i_colony2.size() == 1 && *(i_colony2.begin()) == 1);
+		}
+		#endif
+
+		{
+			title2("get_ranges() and for_each_block() tests");
+
+			colony<int> i_colony;
+			std::vector<std::pair<colony<int>::iterator, colony<int>::iterator> > ranges;
+
+			i_colony.get_ranges(4, std::back_inserter(ranges));
+			failpass("Empty colony get_ranges test", ranges.empty());
+
+			for (int count = 0; count != 50000; ++count)
+			{
+				i_colony.insert(count % 1000);
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				it = ((plf::rand() & 3) == 0) ? i_colony.erase(it) : ++it;
+			}
+
+			const int total = std::accumulate(i_colony.begin(), i_colony.end(), 0);
+
+			i_colony.get_ranges(8, std::back_inserter(ranges));
+
+			int range_total = 0;
+			bool contiguous = (ranges.front().first == i_colony.begin()) && (ranges.back().second == i_colony.end());
+
+			for (unsigned int index = 0; index != ranges.size(); ++index)
+			{
+				range_total += std::accumulate(ranges[index].first, ranges[index].second, 0);
+
+				if (index != 0 && ranges[index].first != ranges[index - 1].second)
+				{
+					contiguous = false;
+				}
+			}
+
+			failpass("get_ranges range count test", ranges.size() >= 2 && ranges.size() <= 8);
+			failpass("get_ranges contiguity test", contiguous);
+			failpass("get_ranges coverage test", range_total == total);
+
+			ranges.clear();
+			i_colony.get_ranges(100000, std::back_inserter(ranges));
+
+			colony<int>::colony_data *data = i_colony.data();
+			failpass("get_ranges maximum ranges test", ranges.size() <= data->number_of_blocks);
+
+			ranges.clear();
+			i_colony.get_ranges(std::numeric_limits<colony<int>::size_type>::max() / 1000, std::back_inserter(ranges)); // running_size * number_of_ranges would overflow
+			contiguous = (ranges.front().first == i_colony.begin()) && (ranges.back().second == i_colony.end());
+
+			for (unsigned int index = 1; index < ranges.size(); ++index)
+			{
+				if (ranges[index].first != ranges[index - 1].second || ranges[index].first == ranges[index].second)
+				{
+					contiguous = false;
+				}
+			}
+
+			failpass("get_ranges large range count test", contiguous && ranges.size() == data->number_of_blocks);
+			delete data;
+
+			int block_total = 0;
+			unsigned int number_of_elements = 0, number_of_blocks = 0;
+
+			i_colony.for_each_block(block_summer(&block_total, &number_of_elements, &number_of_blocks));
+
+			failpass("for_each_block sum test", block_total == total && number_of_elements == i_colony.size());
+
+			colony<int> i_colony2(i_colony.begin(), i_colony.end());
+			const colony<int> &i_colony2_ref = i_colony2;
+			block_total = 0;
+			number_of_elements = number_of_blocks = 0;
+
+			i_colony2_ref.for_each_block(block_summer(&block_total, &number_of_elements, &number_of_blocks));
+
+			failpass("for_each_block no-erasures test", block_total == total && number_of_elements == i_colony2.size() && number_of_blocks == 1);
+
+			i_colony2.clear();
+			block_total = 0;
+			number_of_elements = number_of_blocks = 0;
+			i_colony2.for_each_block(block_summer(&block_total, &number_of_elements, &number_of_blocks));
+
+			failpass("for_each_block empty colony test", number_of_blocks == 0);
+
+			#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT
+				i_colony.for_each_parallel(std::execution::par, [](int &value) { value *= 2; });
+				failpass("for_each_parallel test", std::accumulate(i_colony.begin(), i_colony.end(), 0) == total * 2);
+
+				i_colony.for_each_parallel(std::execution::par_unseq, [](int &value) { value /= 2; }, 3);
+				failpass("for_each_parallel with range count test", std::accumulate(i_colony.begin(), i_colony.end(), 0) == total);
+			#endif
+		}
+
+		{
+			title2("Prefetched for_each tests");
+
+			colony<padded_struct> p_colony;
+			padded_struct value = padded_struct();
+			long long total = 0;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				value.number = count;
+				p_colony.insert(value);
+			}
+
+			for (colony<padded_struct>::iterator it = p_colony.begin(); it != p_colony.end();)
+			{
+				if ((plf::rand() & 7) == 0 || (it->number > 3000 && it->number < 3500))
+				{
+					it = p_colony.erase(it);
+				}
+				else
+				{
+					total += it->number;
+					++it;
+				}
+			}
+
+			long long prefetched_total = 0;
+			unsigned int number_of_elements = 0;
+			p_colony.for_each_prefetched(padded_summer(&prefetched_total, &number_of_elements));
+
+			failpass("for_each_prefetched test", prefetched_total == total && number_of_elements == p_colony.size());
+
+			const colony<padded_struct> &p_colony_ref = p_colony;
+			prefetched_total = 0;
+			number_of_elements = 0;
+			p_colony_ref.for_each_prefetched(padded_summer(&prefetched_total, &number_of_elements), 100000);
+
+			failpass("Const for_each_prefetched with large distance test", prefetched_total == total && number_of_elements == p_colony.size());
+
+			colony<padded_struct> p_colony2(p_colony.begin(), p_colony.end());
+			prefetched_total = 0;
+			number_of_elements = 0;
+			p_colony2.for_each_prefetched(padded_summer(&prefetched_total, &number_of_elements), 0);
+
+			failpass("for_each_prefetched no-erasures test", prefetched_total == total && number_of_elements == p_colony2.size());
+		}
+
+		{
+			title2("Skipfield scanning tests");
+
+			colony<int> i_colony;
+			failpass("Fragmented colony iterator arithmetic and range-erase test", skipfield_scanning_test(i_colony));
+
+			colony<int, std::allocator<int>, plf::memory_use> i_colony2;
+			failpass("Fragmented colony iterator arithmetic and range-erase test (memory_use)", skipfield_scanning_test(i_colony2));
+
+			colony<small_struct_non_trivial> ss_colony;
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				ss_colony.insert(small_struct_non_trivial(count));
+			}
+
+			for (colony<small_struct_non_trivial>::iterator it = ss_colony.begin(); it != ss_colony.end();)
+			{
+				it = ((plf::rand() & 3) == 0) ? ss_colony.erase(it) : ++it;
+			}
+
+			const unsigned int size = static_cast<unsigned int>(ss_colony.size());
+			global_counter = 0;
+
+			ss_colony.erase(next(ss_colony.begin(), 10), prev(ss_colony.end(), 10));
+			failpass("Range-erase destructor count test", global_counter == static_cast<int>(size - 20) && ss_colony.size() == 20);
+		}
+
+		{
+			title2("Generational handle tests");
+
+			typedef colony<int, std::allocator<int>, plf::performance, true> g_colony_type;
+			g_colony_type g_colony;
+			std::vector<g_colony_type::handle> handles;
+
+			for (int count = 0; count != 500; ++count)
+			{
+				handles.push_back(g_colony.get_handle(g_colony.insert(count)));
+			}
+
+			bool all_valid = true;
+
+			for (int count = 0; count != 500; ++count)
+			{
+				all_valid = all_valid && g_colony.is_valid(handles[count]) && *(g_colony.get(handles[count])) == count;
+			}
+
+			failpass("Handle validity after insertion test", all_valid);
+
+			g_colony.erase(g_colony.get_iterator(handles[10]));
+			failpass("Handle invalid after erase test", !g_colony.is_valid(handles[10]) && g_colony.get(handles[10]) == NULL && g_colony.get_iterator(handles[10]) == g_colony.end());
+
+			const g_colony_type::handle reused_handle = g_colony.get_handle(g_colony.insert(1000));
+			failpass("Handle invalid after location reuse test", reused_handle != handles[10] && !g_colony.is_valid(handles[10]) && *(g_colony.get(reused_handle)) == 1000);
+
+			g_colony.erase(g_colony.get_iterator(handles[20]), g_colony.get_iterator(handles[400]));
+			all_valid = true;
+
+			for (int count = 0; count != 500; ++count)
+			{
+				all_valid = all_valid && (g_colony.is_valid(handles[count]) == (count != 10 && (count < 20 || count >= 400)));
+			}
+
+			failpass("Handle validity after range-erase test", all_valid && g_colony.size() == 120);
+
+			g_colony.erase(g_colony.begin(), g_colony.end());
+			all_valid = true;
+
+			for (int count = 0; count != 500; ++count)
+			{
+				all_valid = all_valid && !g_colony.is_valid(handles[count]);
+			}
+
+			failpass("Handles to emptied groups test", all_valid && !g_colony.is_valid(reused_handle));
+
+			handles.clear();
+
+			for (int count = 0; count != 500; ++count)
+			{
+				handles.push_back(g_colony.get_handle(g_colony.insert(count)));
+			}
+
+			g_colony.clear();
+			g_colony.insert(5);
+			failpass("Handle invalid after clear test", !g_colony.is_valid(handles[0]) && !g_colony.is_valid(handles[499]) && g_colony.get(g_colony_type::handle()) == NULL);
+
+			typedef colony<char, std::allocator<char>, plf::memory_use, true> gm_colony_type;
+			gm_colony_type gm_colony(plf::colony_limits(7, 7)); // Odd capacity, so the generation counters need alignment padding after the 8-bit skipfield
+			gm_colony.insert(1);
+			gm_colony.insert(2);
+			const gm_colony_type::handle stale_handle = gm_colony.get_handle(gm_colony.begin());
+
+			for (int count = 0; count != 256; ++count)
+			{
+				gm_colony.erase(gm_colony.begin());
+				gm_colony.insert(3);
+			}
+
+			failpass("memory_use handle invalid after 256 reuses test", !gm_colony.is_valid(stale_handle) && gm_colony.is_valid(gm_colony.get_handle(gm_colony.begin())) && gm_colony.size() == 2);
+
+			g_colony_type g_source(plf::colony_limits(8, 8)), g_destination(plf::colony_limits(8, 8));
+			std::vector<g_colony_type::handle> destination_handles;
+			handles.clear();
+
+			for (int count = 0; count != 100; ++count)
+			{
+				handles.push_back(g_source.get_handle(g_source.insert(count)));
+				destination_handles.push_back(g_destination.get_handle(g_destination.insert(count)));
+			}
+
+			// Empty three groups in each, which are retained as unused groups:
+			g_source.erase(g_source.get_iterator(handles[8]), g_source.get_iterator(handles[32]));
+			g_destination.erase(g_destination.get_iterator(destination_handles[8]), g_destination.get_iterator(destination_handles[32]));
+			g_destination.splice(g_source);
+			all_valid = true;
+
+			for (int count = 0; count != 100; ++count)
+			{
+				all_valid = all_valid && g_destination.is_valid(handles[count]) == (count < 8 || count >= 32) && g_destination.is_valid(destination_handles[count]) == (count < 8 || count >= 32);
+			}
+
+			g_destination.erase(g_destination.get_iterator(handles[50]));
+			failpass("Handle validity after splice test", all_valid && !g_destination.is_valid(handles[50]) && g_destination.get(handles[50]) == NULL && *(g_destination.get(handles[60])) == 60 && g_destination.size() == 151);
+
+			g_colony_type g_empty(plf::colony_limits(8, 8));
+			const g_colony_type::handle erased_handle = g_empty.get_handle(g_empty.insert(1));
+			g_empty.erase(g_empty.begin());
+			g_source.insert(2);
+			g_empty.splice(g_source);
+			failpass("Handle validity after splice into empty colony test", !g_empty.is_valid(erased_handle) && g_empty.get(erased_handle) == NULL && *(g_empty.begin()) == 2 && g_empty.size() == 1);
+		}
+
+		{
+			title2("Concurrent inserter tests");
+
+			colony<int> i_colony(plf::colony_limits(8, 200));
+			i_colony.insert(100, 1);
+
+			{
+				colony<int>::concurrent_inserter inserter(i_colony, 4);
+
+				for (int count = 0; count != 4000; ++count)
+				{
+					inserter.local(static_cast<unsigned int>(count) & 3).insert(count);
+				}
+
+				failpass("Staging isolation test", i_colony.size() == 100 && inserter.local(2).size() == 1000);
+
+				inserter.merge();
+				failpass("Merge test", i_colony.size() == 4100 && inserter.local(2).empty() && std::accumulate(i_colony.begin(), i_colony.end(), 0) == 100 + ((3999 * 4000) / 2));
+
+				inserter.local(1).insert(5);
+			}
+
+			failpass("Merge on destruction test", i_colony.size() == 4101 && i_colony.block_limits().max == 200);
+
+			#ifdef PLF_TEST_THREAD_SUPPORT
+				i_colony.clear();
+
+				{
+					colony<int>::concurrent_inserter inserter(i_colony, 8);
+					std::vector<std::thread> threads;
+
+					for (unsigned int slot = 0; slot != 8; ++slot)
+					{
+						threads.push_back(std::thread([&inserter, slot]
+						{
+							for (int count = 0; count != 10000; ++count)
+							{
+								inserter.local(slot).insert(count);
+							}
+						}));
+					}
+
+					for (std::thread &thread : threads)
+					{
+						thread.join();
+					}
+				}
+
+				failpass("Multithreaded insertion test", i_colony.size() == 80000 && std::accumulate(i_colony.begin(), i_colony.end(), 0) == 8 * ((9999 * 10000) / 2));
+			#endif
+		}
+
+		{
+			title2("Erasure queue tests");
+
+			colony<int> i_colony;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				it = ((plf::rand() & 3) == 0) ? i_colony.erase(it) : ++it;
+			}
+
+			{
+				colony<int>::erasure_queue queue(i_colony);
+				std::vector<int> expected;
+
+				for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it)
+				{
+					if (*it % 7 == 0 || (*it >= 5000 && *it < 9000)) // Scattered erasures, plus a long run covering whole groups
+					{
+						queue.erase_later(it);
+
+						if ((*it & 1) == 0)
+						{
+							queue.erase_later(it); // duplicate
+						}
+					}
+					else
+					{
+						expected.push_back(*it);
+					}
+				}
+
+				const unsigned int original_size = static_cast<unsigned int>(i_colony.size());
+
+				failpass("Flush erasure count test", queue.flush_erasures() == original_size - expected.size() && queue.size() == 0);
+				failpass("Flush result test", i_colony.size() == expected.size() && std::equal(expected.begin(), expected.end(), i_colony.begin()) && std::equal(expected.rbegin(), expected.rend(), i_colony.rbegin()) && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == expected.size());
+
+				for (int count = 0; count != 5000; ++count)
+				{
+					i_colony.insert(-1);
+				}
+
+				failpass("Reinsertion after flush test", i_colony.size() == expected.size() + 5000 && std::count(i_colony.begin(), i_colony.end(), -1) == 5000 && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == i_colony.size());
+
+				for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it)
+				{
+					queue.erase_later(it);
+				}
+			}
+
+			failpass("Flush on destruction test", i_colony.empty() && i_colony.begin() == i_colony.end());
+
+			colony<small_struct_non_trivial> ss_colony;
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				ss_colony.insert(small_struct_non_trivial(count));
+			}
+
+			colony<small_struct_non_trivial>::erasure_queue ss_queue(ss_colony);
+
+			for (colony<small_struct_non_trivial>::iterator it = ss_colony.begin(); it != ss_colony.end(); ++it)
+			{
+				if (it->number % 3 == 0)
+				{
+					ss_queue.erase_later(it);
+				}
+			}
+
+			global_counter = 0;
+			ss_queue.flush_erasures();
+			failpass("Flush destructor count test", global_counter == 334 && ss_colony.size() == 666);
+
+			typedef colony<int, std::allocator<int>, plf::performance, true> g_colony_type;
+			g_colony_type g_colony;
+			g_colony_type::erasure_queue g_queue(g_colony);
+			std::vector<g_colony_type::handle> handles;
+
+			for (int count = 0; count != 100; ++count)
+			{
+				handles.push_back(g_colony.get_handle(g_colony.insert(count)));
+			}
+
+			for (int count = 0; count != 100; count += 2)
+			{
+				g_queue.erase_later(g_colony.get_iterator(handles[static_cast<unsigned int>(count)]));
+			}
+
+			g_queue.flush_erasures();
+			failpass("Flush handle invalidation test", !g_colony.is_valid(handles[0]) && g_colony.is_valid(handles[1]) && !g_colony.is_valid(handles[98]) && g_colony.is_valid(handles[99]));
+		}
+
+		{
+			title2("Position index tests");
+
+			colony<int> i_colony;
+
+			{
+				colony<int>::position_index empty_index(i_colony);
+				failpass("Empty index test", empty_index.get_iterator(0) == i_colony.cend());
+			}
+
+			for (int count = 0; count != 30000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				it = ((*it < 20000 && (plf::rand() & 3) == 0) || (*it >= 10000 && *it < 10500)) ? i_colony.erase(it) : ++it; // Later groups are left without erasures
+			}
+
+			colony<int>::position_index index(i_colony);
+			bool index_valid = true, iterator_valid = true;
+			unsigned int current_index = 0;
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it, ++current_index)
+			{
+				if (index.get_index(it) != current_index)
+				{
+					index_valid = false;
+				}
+
+				if (index.get_iterator(current_index) != it)
+				{
+					iterator_valid = false;
+				}
+			}
+
+			failpass("get_index test", index_valid && index.get_index(i_colony.end()) == i_colony.size());
+			failpass("get_iterator test", iterator_valid && index.get_iterator(i_colony.size()) == i_colony.cend() && index.get_iterator(i_colony.size() + 100) == i_colony.cend());
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				const unsigned int random_index = static_cast<unsigned int>(plf::rand()) % static_cast<unsigned int>(i_colony.size());
+				colony<int>::const_iterator it = i_colony.cbegin();
+				advance(it, random_index);
+
+				if (index.get_iterator(random_index) != it)
+				{
+					iterator_valid = false;
+				}
+			}
+
+			failpass("Random access test", iterator_valid);
+
+			i_colony.erase(i_colony.begin(), index.get_iterator(5000));
+
+			for (int count = 0; count != 3000; ++count)
+			{
+				i_colony.insert(-1);
+			}
+
+			index.rebuild();
+			index_valid = true;
+			current_index = 0;
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it, ++current_index)
+			{
+				if (index.get_index(it) != current_index || index.get_iterator(current_index) != it)
+				{
+					index_valid = false;
+				}
+			}
+
+			failpass("Rebuild test", index_valid && current_index == i_colony.size());
+
+			i_colony.erase(index.get_iterator(1000), index.get_iterator(i_colony.size() - 1000)); // Removes whole groups from the middle, leaving non-contiguous group numbers
+			index.rebuild();
+			index_valid = true;
+			current_index = 0;
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end(); ++it, ++current_index)
+			{
+				if (index.get_index(it) != current_index || index.get_iterator(current_index) != it)
+				{
+					index_valid = false;
+				}
+			}
+
+			failpass("Rebuild after range-erase test", index_valid && current_index == 2000 && index.get_index(i_colony.end()) == 2000);
+		}
+
+		{
+			title2("Incremental consolidation tests");
+
+			colony<int> i_colony;
+			std::vector<int *> locations(20000, static_cast<int *>(NULL));
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				locations[static_cast<unsigned int>(count)] = &*(i_colony.insert(count));
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				if ((plf::rand() & 3) != 0 || (*it >= 6000 && *it < 7000))
+				{
+					locations[static_cast<unsigned int>(*it)] = NULL;
+					it = i_colony.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			const unsigned int original_size = static_cast<unsigned int>(i_colony.size());
+			const int original_total = std::accumulate(i_colony.begin(), i_colony.end(), 0);
+			const unsigned int original_memory = static_cast<unsigned int>(i_colony.memory());
+			int mismatches = 0;
+			unsigned int number_of_steps = 0, total_moved = 0, moved;
+
+			do
+			{
+				moved = static_cast<unsigned int>(i_colony.consolidate_step(100, relocation_recorder(&locations, &mismatches)));
+				total_moved += moved;
+				++number_of_steps;
+			} while (moved == 100);
+
+			failpass("Step count test", number_of_steps > 2 && total_moved != 0);
+			failpass("Relocation notification test", mismatches == 0);
+
+			bool locations_valid = true;
+
+			for (unsigned int index = 0; index != 20000; ++index)
+			{
+				if (locations[index] != NULL && *(locations[index]) != static_cast<int>(index))
+				{
+					locations_valid = false;
+				}
+			}
+
+			failpass("Patched pointer test", locations_valid);
+			failpass("Contents preserved test", i_colony.size() == original_size && std::accumulate(i_colony.begin(), i_colony.end(), 0) == original_total && static_cast<unsigned int>(distance(i_colony.begin(), i_colony.end())) == original_size && static_cast<unsigned int>(distance(i_colony.rbegin(), i_colony.rend())) == original_size);
+
+			i_colony.trim();
+			failpass("Memory reduction test", static_cast<unsigned int>(i_colony.memory()) < original_memory);
+			failpass("Compacted colony test", i_colony.consolidate_step(100) == 0);
+
+			for (int count = 0; count != 5000; ++count)
+			{
+				i_colony.insert(-1);
+			}
+
+			failpass("Insertion after consolidation test", i_colony.size() == original_size + 5000 && std::count(i_colony.begin(), i_colony.end(), -1) == 5000);
+
+			colony<int> single_group_colony;
+			single_group_colony.insert(1);
+			single_group_colony.insert(2);
+			single_group_colony.erase(single_group_colony.begin());
+			failpass("Single group test", single_group_colony.consolidate_step(10) == 0 && *(single_group_colony.begin()) == 2);
+		}
+
+		{
+			title2("Relocation observer tests");
+
+			colony<int> i_colony;
+			std::vector<int *> locations(10000, static_cast<int *>(NULL));
+
+			for (int count = 0; count != 10000; ++count)
+			{
+				locations[static_cast<unsigned int>(count)] = &*(i_colony.insert(count));
+			}
+
+			for (colony<int>::iterator it = i_colony.begin(); it != i_colony.end();)
+			{
+				if ((*it % 3) != 0)
+				{
+					locations[static_cast<unsigned int>(*it)] = NULL;
+					it = i_colony.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			int mismatches = 0;
+			i_colony.shrink_to_fit(relocation_recorder(&locations, &mismatches));
+
+			bool locations_valid = true;
+
+			for (unsigned int index = 0; index != 10000; ++index)
+			{
+				if (locations[index] != NULL && *(locations[index]) != static_cast<int>(index))
+				{
+					locations_valid = false;
+				}
+			}
+
+			failpass("shrink_to_fit observer test", mismatches == 0 && locations_valid && i_colony.size() == 3334 && i_colony.capacity() == 3334);
+
+			i_colony.reshape(plf::colony_limits(200, 200), relocation_recorder(&locations, &mismatches));
+
+			for (unsigned int index = 0; index != 10000; ++index)
+			{
+				if (locations[index] != NULL && *(locations[index]) != static_cast<int>(index))
+				{
+					locations_valid = false;
+				}
+			}
+
+			failpass("reshape observer test", mismatches == 0 && locations_valid && i_colony.size() == 3334 && i_colony.block_limits().max == 200);
+
+			colony<small_struct_non_trivial> ss_colony;
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				ss_colony.insert(small_struct_non_trivial(count));
+			}
+
+			for (colony<small_struct_non_trivial>::iterator it = ss_colony.begin(); it != ss_colony.end();)
+			{
+				it = ((it->number & 1) == 0) ? ss_colony.erase(it) : ++it;
+			}
+
+			global_counter = 0;
+			ss_colony.shrink_to_fit();
+			failpass("Non-trivial shrink_to_fit test", ss_colony.size() == 500 && ss_colony.capacity() == 500 && global_counter == 500);
+		}
+
+		{
+			title2("Block capacity for bytes tests");
+
+			failpass("Int capacity test", colony<int>::block_capacity_for_bytes(1000) == 166);
+			failpass("Capacity clamp test", colony<int>::block_capacity_for_bytes(std::numeric_limits<size_t>::max() / 2) == std::numeric_limits<unsigned short>::max());
+			failpass("Too small test", colony<int>::block_capacity_for_bytes(8) == 0);
+		}
+
+		{
+			title2("Cold value tests");
+
+			typedef colony<int, std::allocator<int>, plf::performance, false, cold_record> cold_colony_type;
+			cold_colony_type c_colony;
+
+			c_colony.insert(7);
+			failpass("Zeroed cold value test", c_colony.cold(c_colony.begin()).id == 0 && c_colony.cold(c_colony.begin()).weight == 0);
+			c_colony.clear();
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				const cold_record record = {count, count * 0.5};
+				c_colony.insert_with_cold(count, record);
+			}
+
+			failpass("Insert with cold test", c_colony.size() == 20000 && cold_values_match(c_colony));
+
+			for (cold_colony_type::iterator it = c_colony.begin(); it != c_colony.end();)
+			{
+				it = ((*it % 3) == 0 || (*it > 5000 && *it < 9000)) ? c_colony.erase(it) : ++it;
+			}
+
+			for (int count = 20000; count != 22000; ++count)
+			{
+				const cold_record record = {count, count * 0.5};
+				c_colony.insert_with_cold(count, record);
+			}
+
+			failpass("Erased location reuse test", cold_values_match(c_colony));
+
+			cold_colony_type c_colony2(c_colony);
+			failpass("Copy test", c_colony2.size() == c_colony.size() && cold_values_match(c_colony2));
+
+			c_colony2.sort(std::greater<int>());
+			failpass("Sort test", *c_colony2.begin() == 21999 && cold_values_match(c_colony2));
+
+			for (int count = 0; count != 40; ++count)
+			{
+				c_colony.consolidate_step(100);
+			}
+
+			failpass("Consolidate step test", cold_values_match(c_colony));
+
+			c_colony.shrink_to_fit();
+			failpass("Shrink to fit test", c_colony.capacity() == c_colony.size() && cold_values_match(c_colony));
+
+			#ifdef PLF_TEST_TYPE_TRAITS_SUPPORT
+				std::vector<char> buffer;
+				c_colony2.snapshot(snapshot_writer(&buffer));
+				cold_colony_type c_colony3;
+				size_t position = 0;
+				c_colony3.restore(snapshot_reader(&buffer, &position));
+				failpass("Snapshot test", position == buffer.size() && c_colony3 == c_colony2 && cold_values_match(c_colony3));
+			#endif
+
+			colony<int> plain_colony(c_colony.begin(), c_colony.end());
+			failpass("Memory test", c_colony.memory() > plain_colony.memory() + c_colony.size() * sizeof(cold_record) - 1);
+		}
+
+		{
+			title2("Statistics tests");
+
+			colony<int> i_colony(plf::colony_limits(100, 100));
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			plf::colony_statistics stats = i_colony.statistics();
+			failpass("Group count test", stats.number_of_groups == 10 && stats.fill_histogram[7] == 10 && stats.capacity_histogram[6] == 10 && stats.number_of_unused_groups == 0);
+			failpass("Allocation counter test", stats.group_allocations == 10 && stats.group_deallocations == 0);
+
+			colony<int>::iterator it = i_colony.begin();
+			advance(it, 10);
+			it = i_colony.erase(it);
+			i_colony.erase(it);
+			it = i_colony.begin();
+			advance(it, 18);
+			i_colony.erase(it);
+
+			it = i_colony.begin();
+			advance(it, 500);
+			colony<int>::iterator it2 = it;
+			advance(it2, 60);
+			i_colony.erase(it, it2);
+
+			it = i_colony.begin();
+			advance(it, 200);
+			it2 = it;
+			advance(it2, 100);
+			i_colony.erase(it, it2);
+
+			stats = i_colony.statistics();
+			failpass("Skipblock count test", stats.total_skipblocks >= 3 && stats.number_of_groups_with_erasures >= 2 && stats.number_of_groups_with_erasures <= stats.number_of_groups);
+			failpass("Fill histogram test", std::accumulate(stats.fill_histogram, stats.fill_histogram + plf::colony_statistics::fill_buckets, static_cast<size_t>(0)) == stats.number_of_groups && stats.fill_histogram[7] < 10);
+			failpass("Group accounting test", stats.group_allocations - stats.group_deallocations == stats.number_of_groups + stats.number_of_unused_groups);
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			i_colony.shrink_to_fit();
+			stats = i_colony.statistics();
+			failpass("Shrink to fit accounting test", stats.number_of_groups == (i_colony.size() + 99) / 100 && stats.total_skipblocks == 0 && stats.number_of_groups_with_erasures == 0 && stats.group_allocations - stats.group_deallocations == stats.number_of_groups);
+
+			i_colony.clear();
+			i_colony.insert(1000, 1);
+			stats = i_colony.statistics();
+			failpass("Group recycle test", stats.group_recycles >= 9 && stats.group_allocations - stats.group_deallocations == stats.number_of_groups + stats.number_of_unused_groups);
+
+			i_colony.clear();
+			i_colony.trim();
+			stats = i_colony.statistics();
+			failpass("Clear and trim test", stats.number_of_groups == 0 && stats.group_allocations - stats.group_deallocations == stats.number_of_unused_groups);
+
+			colony<int> i_colony2;
+			i_colony2.swap(i_colony);
+			failpass("Counters stay with colony test", i_colony2.statistics().group_allocations == 0 && i_colony.statistics().group_allocations == stats.group_allocations);
+		}
+
+		{
+			title2("Growth policy tests");
+
+			colony<int> i_colony(plf::colony_limits(10, 40));
+			failpass("Default policy test", i_colony.growth_policy() == NULL);
+
+			i_colony.set_growth_policy(recording_growth_policy);
+
+			for (int count = 0; count != 20; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			failpass("Policy clamp test", i_colony.capacity() == 50 && last_growth_state.size == 10 && last_growth_state.back_group_capacity == 10 && last_growth_state.max_capacity == 40);
+
+			colony<int>::iterator it = i_colony.begin();
+			it = i_colony.erase(it);
+			++it;
+			i_colony.erase(it);
+
+			for (int count = 0; count != 34; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			failpass("Policy state test", i_colony.capacity() == 90 && last_growth_state.size == 50 && last_growth_state.back_group_capacity == 40 && last_growth_state.reuses == 2);
+
+			colony<int> i_colony2(i_colony);
+			i_colony.clear();
+			failpass("Policy copy test", i_colony2.growth_policy() == recording_growth_policy && i_colony2.size() == 52);
+
+			colony<int> i_colony3;
+			i_colony3.swap(i_colony2);
+			failpass("Policy swap test", i_colony3.growth_policy() == recording_growth_policy && i_colony2.growth_policy() == NULL);
+
+			i_colony3.set_growth_policy(NULL);
+
+			for (int count = 0; count != 100; ++count)
+			{
+				i_colony3.insert(count);
+			}
+
+			failpass("Policy reset test", i_colony3.growth_policy() == NULL && last_growth_state.size == 50);
+
+			colony<int> default_colony, adaptive_colony;
+			adaptive_colony.set_growth_policy(plf::colony_adaptive_growth);
+
+			for (int count = 0; count != 100000; ++count)
+			{
+				default_colony.insert(count);
+				adaptive_colony.insert(count);
+			}
+
+			failpass("Adaptive burst test", adaptive_colony.statistics().group_allocations < default_colony.statistics().group_allocations);
+
+			colony<int> default_churn_colony, adaptive_churn_colony;
+			adaptive_churn_colony.set_growth_policy(plf::colony_adaptive_growth);
+			const size_t default_memory = churn_memory(default_churn_colony);
+			failpass("Adaptive churn test", churn_memory(adaptive_churn_colony) < default_memory && adaptive_churn_colony.size() == default_churn_colony.size());
+		}
+
+		#if defined(PLF_TEST_MOVE_SEMANTICS_SUPPORT) && defined(PLF_TEST_TYPE_TRAITS_SUPPORT)
+		{
+			title2("Block pool tests");
+
+			typedef colony<int, plf::colony_pool_allocator<int> > pool_colony_type;
+			plf::colony_block_pool pool;
+			const plf::colony_pool_allocator<int> pool_allocator(pool);
+
+			{
+				pool_colony_type p_colony(pool_allocator);
+
+				for (int count = 0; count != 10000; ++count)
+				{
+					p_colony.insert(count);
+				}
+
+				failpass("Pool allocation test", std::accumulate(p_colony.begin(), p_colony.end(), 0) == (9999 * 10000) / 2 && pool.cached_bytes() == 0);
+			}
+
+			const size_t cached_after_destruction = pool.cached_bytes();
+			failpass("Pool retains freed blocks test", cached_after_destruction != 0);
+
+			{
+				pool_colony_type p_colony(pool_allocator);
+
+				for (int count = 0; count != 10000; ++count)
+				{
+					p_colony.insert(count);
+				}
+
+				failpass("Pool reuses freed blocks test", pool.cached_bytes() == 0 && p_colony.size() == 10000);
+
+				pool_colony_type p_colony2(pool_allocator);
+				p_colony2.insert(500, 3);
+				p_colony.splice(p_colony2);
+				failpass("Pool colony splice test", p_colony.size() == 10500);
+			}
+
+			pool.release();
+			failpass("Pool release test", pool.cached_bytes() == 0);
+
+			plf::colony_block_pool small_pool(1024);
+
+			{
+				colony<int, plf::colony_pool_allocator<int> > p_colony((plf::colony_pool_allocator<int>(small_pool)));
+				p_colony.insert(10000, 1);
+			}
+
+			failpass("Pool cache limit test", small_pool.cached_bytes() <= 1024);
+
+			#ifdef PLF_TEST_THREAD_SUPPORT
+				std::vector<std::thread> threads;
+				std::vector<int> totals(8, 0);
+
+				for (unsigned int thread_number = 0; thread_number != 8; ++thread_number)
+				{
+					threads.push_back(std::thread([&pool_allocator, &totals, thread_number]
+					{
+						for (int repeat = 0; repeat != 200; ++repeat)
+						{
+							pool_colony_type p_colony(pool_allocator);
+
+							for (int count = 0; count != 1000; ++count)
+							{
+								p_colony.insert(count);
+							}
+
+							totals[thread_number] += static_cast<int>(p_colony.size());
+						}
+					}));
+				}
+
+				for (std::thread &thread : threads)
+				{
+					thread.join();
+				}
+
+				failpass("Multithreaded pool test", std::accumulate(totals.begin(), totals.end(), 0) == 8 * 200 * 1000);
+			#endif
+		}
+		#endif
+
+		#if defined(PLF_TEST_MOVE_SEMANTICS_SUPPORT) && defined(PLF_TEST_TYPE_TRAITS_SUPPORT) && (defined(__linux__) || defined(__cpp_aligned_new))
+		{
+			title2("Huge page allocation tests");
+
+			struct large_struct
+			{
+				int number;
+				char padding[60];
+			};
+
+			typedef colony<large_struct, plf::colony_huge_page_allocator<large_struct> > huge_colony_type;
+			plf::colony_huge_page_arena arena;
+			const size_t capacity = huge_colony_type::block_capacity_for_bytes(arena.block_bytes());
+
+			{
+				huge_colony_type h_colony(plf::colony_limits(capacity, capacity), plf::colony_huge_page_allocator<large_struct>(arena));
+				large_struct value;
+
+				for (int count = 0; count != 100000; ++count)
+				{
+					value.number = count;
+					h_colony.insert(value);
+				}
+
+				bool aligned = true;
+				int total = 0;
+
+				for (huge_colony_type::iterator it = h_colony.begin(); it != h_colony.end(); ++it)
+				{
+					total += it->number & 1;
+				}
+
+				for (size_t index = 0; index < h_colony.size(); index += capacity)
+				{
+					huge_colony_type::iterator it = h_colony.begin();
+					advance(it, index);
+
+					if ((reinterpret_cast<size_t>(&*it) & (arena.region_bytes() - 1)) != 64) // Each group's block begins after the region header
+					{
+						aligned = false;
+					}
+				}
+
+				failpass("Huge page contents test", h_colony.size() == 100000 && total == 50000);
+				failpass("Region alignment test", aligned && capacity * sizeof(large_struct) > arena.region_bytes() * 9 / 10);
+
+				for (huge_colony_type::iterator it = h_colony.begin(); it != h_colony.end();)
+				{
+					it = ((it->number % 3) == 0) ? h_colony.erase(it) : ++it;
+				}
+
+				h_colony.shrink_to_fit();
+				failpass("Huge page shrink_to_fit test", h_colony.size() == 66666);
+			}
+
+			colony<int, plf::colony_huge_page_allocator<int> > i_colony;
+
+			for (int count = 0; count != 200000; ++count)
+			{
+				i_colony.insert(count);
+			}
+
+			failpass("Shared arena small block test", i_colony.size() == 200000 && std::accumulate(i_colony.begin(), i_colony.end(), 0LL) == 199999LL * 100000LL);
+
+			plf::colony_huge_page_arena numa_arena(2 * 1024 * 1024, 0);
+			const plf::colony_huge_page_allocator<int> numa_allocator(numa_arena);
+			colony<int, plf::colony_huge_page_allocator<int> > n_colony(numa_allocator);
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				n_colony.insert(count);
+			}
+
+			failpass("NUMA arena test", std::accumulate(n_colony.begin(), n_colony.end(), 0) == 999 * 500);
+		}
+		#endif
 	}
 
 	title1("Test Suite PASS - Press ENTER to Exit");
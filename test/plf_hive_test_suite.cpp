@@ -6,6 +6,12 @@
 #include <cstdlib> // abort
 #include <utility> // std::move
 
+#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT // defined by the build system when a parallel backend is available
+	#include <atomic> // std::atomic
+	#include <execution> // std::execution::par
+	#include <stdexcept> // std::runtime_error
+#endif
+
 #include "plf_hive.h"
 
 
@@ -108,6 +114,27 @@ struct small_struct_non_trivial
 
 
 
+#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT
+	std::atomic<int> copies_until_throw(-1);
+
+	struct throwing_copy_type // copy constructor throws once copies_until_throw reaches 0
+	{
+		int number;
+
+		throwing_copy_type(const int num) : number(num) {}
+
+		throwing_copy_type(const throwing_copy_type &source) : number(source.number)
+		{
+			if (copies_until_throw-- == 0)
+			{
+				throw std::runtime_error("copy");
+			}
+		}
+	};
+#endif
+
+
+
 
 
 int main()
@@ -1834,6 +1861,620 @@ int main()
 			failpass("erase_if test",	static_cast<int>(i_hive.size()) == 500);
 
 		}
+
+		{
+			title2("Fragmented iterator arithmetic tests");
+
+			hive<int> i_hive;
+
+			for (int count = 0; count != 100; ++count)
+			{
+				i_hive.insert(count);
+			}
+
+			i_hive.erase(i_hive.begin());
+			i_hive.erase(std::next(i_hive.begin(), 10));
+			i_hive.erase(std::prev(i_hive.end()));
+
+			hive<int>::iterator it = i_hive.end();
+			advance(it, -1);
+			failpass("Advance backwards from end() test", *it == 98);
+
+			it = std::next(i_hive.begin(), 5);
+			advance(it, 6);
+			failpass("Advance over erasure test", *it == 13);
+			failpass("Distance over erasures test", distance(i_hive.begin(), it) == 11 && distance(i_hive.begin(), i_hive.end()) == 97);
+
+			int counter = 0;
+
+			for (hive<int>::reverse_iterator r_it = i_hive.rbegin(); r_it != i_hive.rend(); ++r_it)
+			{
+				++counter;
+			}
+
+			failpass("Reverse iteration with erased first element test", counter == 97);
+		}
+
+		{
+			title2("Group index tests");
+
+			hive<int> i_hive(plf::hive_limits(8, 64)), i_hive2(plf::hive_limits(8, 64));
+			vector<int *> pointers;
+
+			i_hive.enable_group_index();
+			failpass("Enable test", i_hive.group_index_enabled() && !i_hive2.group_index_enabled());
+			failpass("Empty hive test", i_hive.get_iterator(static_cast<int *>(NULL)) == i_hive.end());
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				pointers.push_back(&*i_hive.insert(count));
+				i_hive2.insert(count);
+			}
+
+			bool found = true;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				hive<int>::iterator it = i_hive.get_iterator(pointers[count]);
+
+				if (it == i_hive.end() || &*it != pointers[count])
+				{
+					found = false;
+				}
+			}
+
+			failpass("Pointer-to-iterator test", found);
+
+			int outside = 0;
+			failpass("Non-element pointer test", i_hive.get_iterator(&outside) == i_hive.end() && i_hive2.get_iterator(&outside) == i_hive2.end());
+
+			for (int count = 0; count < 20000; count += 3)
+			{
+				i_hive.erase(i_hive.get_iterator(pointers[count]));
+			}
+
+			found = true;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				if ((i_hive.get_iterator(pointers[count]) == i_hive.end()) != (count % 3 == 0))
+				{
+					found = false;
+				}
+			}
+
+			failpass("Erased element test", found);
+
+			i_hive.erase(std::next(i_hive.begin(), 2000), std::next(i_hive.begin(), 4000)); // Empties groups, which are retained as unused
+			pointers.clear();
+
+			for (hive<int>::iterator it = i_hive.begin(); it != i_hive.end(); ++it)
+			{
+				pointers.push_back(&*it);
+			}
+
+			found = true;
+
+			for (unsigned int count = 0; count != pointers.size(); ++count)
+			{
+				if (i_hive.get_iterator(pointers[count]) == i_hive.end())
+				{
+					found = false;
+				}
+			}
+
+			const hive<int> &const_hive = i_hive;
+			failpass("Range-erase test", found && const_hive.get_iterator(const_cast<const int *>(pointers.back())) != const_hive.cend());
+
+			int *spliced_pointer = &*std::next(i_hive2.begin(), 5000);
+			i_hive.splice(i_hive2);
+			failpass("Splice test", i_hive.get_iterator(spliced_pointer) != i_hive.end() && *i_hive.get_iterator(spliced_pointer) == 5000 && i_hive.get_iterator(pointers.front()) != i_hive.end());
+
+			i_hive.swap(i_hive2);
+			failpass("Swap test", i_hive.group_index_enabled() && !i_hive2.group_index_enabled() && i_hive.get_iterator(spliced_pointer) == i_hive.end() && i_hive2.get_iterator(spliced_pointer) != i_hive2.end());
+
+			i_hive = std::move(i_hive2);
+			failpass("Move test", i_hive.group_index_enabled() && i_hive.get_iterator(spliced_pointer) != i_hive.end() && *i_hive.get_iterator(spliced_pointer) == 5000);
+
+			i_hive.clear();
+			i_hive.insert(1);
+			i_hive.reserve(10000);
+			failpass("Clear + reserve test", i_hive.get_iterator(spliced_pointer) == i_hive.end() && *i_hive.get_iterator(&*i_hive.begin()) == 1);
+
+			i_hive.disable_group_index();
+			failpass("Disable test", !i_hive.group_index_enabled() && *i_hive.get_iterator(&*i_hive.begin()) == 1);
+		}
+
+		{
+			title2("Splice ordering tests");
+
+			hive<int> early_worker(plf::hive_limits(8, 64)), master(plf::hive_limits(8, 64));
+
+			for (int count = 0; count != 500; ++count) // Filled before the master, so its group numbers are lower
+			{
+				early_worker.insert(count);
+			}
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				master.insert(count);
+			}
+
+			for (int worker_number = 0; worker_number != 20; ++worker_number)
+			{
+				hive<int> worker(plf::hive_limits(8, 64));
+
+				for (int count = 0; count != 300; ++count)
+				{
+					worker.insert(count);
+				}
+
+				worker.erase(std::next(worker.begin(), 100));
+				master.splice(worker);
+			}
+
+			master.splice(early_worker);
+
+			bool ordered = true;
+
+			for (hive<int>::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it) || it <= previous)
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Iterator ordering test", ordered && master.size() == 1000 + (20 * 299) + 500 && static_cast<hive<int>::size_type>(distance(master.begin(), master.end())) == master.size());
+			failpass("Reverse distance test", distance(master.end(), master.begin()) == -static_cast<hive<int>::difference_type>(master.size()));
+
+			master.erase(master.begin(), std::next(master.begin(), 70)); // Removes front groups
+			master.erase(std::next(master.begin(), 2000), std::next(master.begin(), 2200)); // Removes middle groups
+
+			for (hive<int>::iterator it = master.begin(); it != master.end(); ++it)
+			{
+				if (*it == 50)
+				{
+					it = master.erase(it);
+				}
+			}
+
+			ordered = true;
+
+			for (hive<int>::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it))
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Ordering after group removal test", ordered && static_cast<hive<int>::size_type>(distance(master.begin(), master.end())) == master.size());
+
+			for (int count = 0; count != 3000; ++count)
+			{
+				master.insert(count);
+			}
+
+			ordered = true;
+
+			for (hive<int>::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it))
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Ordering after reinsertion test", ordered && static_cast<hive<int>::size_type>(distance(master.begin(), master.end())) == master.size());
+		}
+
+		{
+			title2("Splice renumbering tests");
+
+			hive<int> master(plf::hive_limits(8, 64));
+			master.reserve(10000); // Leaves spare capacity in the master's back group, but the master has more groups than each worker, so splice() appends rather than swapping
+
+			for (int count = 0; count != 5000; ++count)
+			{
+				master.insert(count);
+			}
+
+			master.erase(std::next(master.begin(), 10)); // Gives the master a groups-with-erasures list to join
+
+			for (int worker_number = 1; worker_number != 11; ++worker_number)
+			{
+				hive<int> worker(plf::hive_limits(8, 64));
+
+				for (int count = 0; count != 64; ++count) // Fills the worker's back group
+				{
+					worker.insert(-worker_number);
+				}
+
+				worker.erase(worker.begin());
+				master.splice(worker);
+			}
+
+			bool ordered = true;
+
+			for (hive<int>::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it) || it <= previous)
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Unswapped splice order test", ordered && *master.begin() == 0 && *std::prev(master.end()) == -10 && master.size() == 4999 + (10 * 63));
+
+			for (int count = 0; count != 11; ++count) // Reuses the erased locations from every joined groups-with-erasures list
+			{
+				master.insert(-100);
+			}
+
+			ordered = true;
+
+			for (hive<int>::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it))
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Splice erasure reuse test", ordered && master.size() == 5000 + (10 * 64) && static_cast<hive<int>::size_type>(distance(master.begin(), master.end())) == master.size());
+
+			hive<int> destination(plf::hive_limits(64, 64)), source(plf::hive_limits(64, 64));
+
+			for (int count = 0; count != 128; ++count) // Leaves no spare back capacity, so splice() does not swap
+			{
+				destination.insert(count);
+			}
+
+			for (int count = 0; count != 100; ++count)
+			{
+				source.insert(count);
+			}
+
+			source.reserve(1000); // Unused groups, which splice() deallocates
+			destination.splice(source);
+			failpass("Splice capacity test", destination.capacity() == 256 && destination.size() == 228 && source.capacity() == 0);
+
+			hive<int> small_destination(plf::hive_limits(64, 64)), small_source(plf::hive_limits(64, 64));
+
+			for (int count = 0; count != 10; ++count) // Spare back capacity and no more groups than the source, so splice() swaps
+			{
+				small_destination.insert(count);
+			}
+
+			for (int count = 0; count != 64; ++count)
+			{
+				small_source.insert(-1);
+			}
+
+			small_destination.splice(small_source);
+
+			ordered = true;
+
+			for (hive<int>::iterator previous = small_destination.begin(), it = std::next(small_destination.begin()); it != small_destination.end(); previous = it++)
+			{
+				if (!(previous < it) || it <= previous)
+				{
+					ordered = false;
+				}
+			}
+
+			failpass("Swapped splice order test", ordered && *small_destination.begin() == -1 && *std::prev(small_destination.end()) == 9 && small_destination.size() == 74);
+		}
+
+		{
+			title2("Bitset priority tests");
+
+			typedef hive<int, std::allocator<int>, hive_priority::bitset> bitset_hive;
+
+			bitset_hive bh(plf::hive_limits(8, 200));
+			vector<int> reference;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				bh.insert(count);
+				reference.push_back(count);
+			}
+
+			failpass("Size test", bh.size() == 20000 && static_cast<bitset_hive::size_type>(distance(bh.begin(), bh.end())) == bh.size());
+
+			for (bitset_hive::iterator it = bh.begin(); it != bh.end();)
+			{
+				if ((rand() & 3) == 0)
+				{
+					reference[static_cast<size_t>(*it)] = -1;
+					it = bh.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			reference.erase(std::remove(reference.begin(), reference.end(), -1), reference.end());
+
+			failpass("Erase test", bh.size() == reference.size() && std::equal(bh.begin(), bh.end(), reference.begin()));
+			failpass("Reverse iteration test", std::equal(bh.rbegin(), bh.rend(), reference.rbegin()) && distance(bh.rbegin(), bh.rend()) == static_cast<bitset_hive::difference_type>(bh.size()));
+
+			bool passed = true;
+
+			for (size_t index = 0; index < reference.size(); index += 37)
+			{
+				bitset_hive::iterator it = bh.begin();
+				advance(it, index);
+				bitset_hive::reverse_iterator r_it = bh.rbegin();
+				advance(r_it, reference.size() - index - 1);
+
+				if (*it != reference[index] || *r_it != reference[index] || static_cast<size_t>(distance(bh.begin(), it)) != index || prev(bh.end(), static_cast<bitset_hive::difference_type>(reference.size() - index)) != it || bh.get_iterator(&*it) != it)
+				{
+					passed = false;
+				}
+			}
+
+			bitset_hive::iterator bound_it = bh.begin();
+			advance(bound_it, bh.size() + 10);
+			bitset_hive::reverse_iterator bound_r_it = bh.rbegin();
+			advance(bound_r_it, bh.size() + 10);
+
+			failpass("Advance/distance test", passed && bound_it == bh.end() && bound_r_it == bh.rend());
+
+			int * const erased_pointer = &*std::next(bh.begin(), 500);
+			bh.erase(std::next(bh.begin(), 500), std::next(bh.begin(), 5000));
+			reference.erase(reference.begin() + 500, reference.begin() + 5000);
+
+			failpass("Range-erase test", bh.size() == reference.size() && std::equal(bh.begin(), bh.end(), reference.begin()) && bh.get_iterator(erased_pointer) == bh.end());
+
+			for (int count = 0; count != 3000; ++count)
+			{
+				bh.insert(count + 100000);
+				reference.push_back(count + 100000);
+			}
+
+			std::sort(reference.begin(), reference.end());
+			bh.sort();
+
+			failpass("Reinsertion and sort test", bh.size() == reference.size() && std::equal(bh.begin(), bh.end(), reference.begin()));
+
+			bitset_hive bh2(bh), bh3(plf::hive_limits(8, 200));
+
+			for (int count = 0; count != 1000; ++count)
+			{
+				bh3.insert(count);
+			}
+
+			bh3.erase(std::next(bh3.begin(), 10), std::next(bh3.begin(), 900));
+			bh2.splice(bh3);
+
+			failpass("Copy and splice test", bh2.size() == bh.size() + 110 && bh3.empty() && static_cast<bitset_hive::size_type>(distance(bh2.begin(), bh2.end())) == bh2.size());
+
+			bitset_hive master(plf::hive_limits(8, 64));
+			master.reserve(1000); // Spare back capacity, but more groups than each worker, so each splice appends the worker's groups
+
+			for (int count = 0; count != 500; ++count)
+			{
+				master.insert(count);
+			}
+
+			master.erase(master.begin());
+
+			for (int worker_number = 1; worker_number != 6; ++worker_number)
+			{
+				bitset_hive worker(plf::hive_limits(8, 64));
+
+				for (int count = 0; count != 64; ++count)
+				{
+					worker.insert(-worker_number);
+				}
+
+				worker.erase(std::next(worker.begin(), 5));
+				master.splice(worker);
+			}
+
+			bool ordered = true;
+
+			for (bitset_hive::iterator previous = master.begin(), it = std::next(master.begin()); it != master.end(); previous = it++)
+			{
+				if (!(previous < it))
+				{
+					ordered = false;
+				}
+			}
+
+			const bool appended = *master.begin() == 1 && *std::prev(master.end()) == -5;
+
+			for (int count = 0; count != 6; ++count)
+			{
+				master.insert(-100);
+			}
+
+			failpass("Splice test", ordered && appended && master.size() == 500 + (5 * 64) && static_cast<bitset_hive::size_type>(distance(master.begin(), master.end())) == master.size());
+
+			bh2.swap(bh3);
+			const bitset_hive::size_type old_capacity = bh3.capacity();
+			bh3.shrink_to_fit();
+
+			failpass("Swap and shrink_to_fit test", bh2.empty() && bh3.size() == bh.size() + 110 && bh3.capacity() < old_capacity && bh3.capacity() - bh3.size() < 8 && std::accumulate(bh3.begin(), bh3.end(), 0ll) == std::accumulate(bh.begin(), bh.end(), 0ll) + 45 + 94950);
+
+			bh.clear();
+			bh.trim();
+			failpass("Clear test", bh.empty() && bh.begin() == bh.end());
+
+			const bitset_hive empty_bh;
+			failpass("Empty reverse iteration test", bh.rbegin() == bh.rend() && empty_bh.crbegin() == empty_bh.crend());
+
+			bitset_hive indexed_bh(plf::hive_limits(8, 64));
+			vector<int *> bh_pointers;
+			indexed_bh.enable_group_index();
+
+			for (int count = 0; count != 5000; ++count)
+			{
+				bh_pointers.push_back(&*indexed_bh.insert(count));
+			}
+
+			for (int count = 0; count < 5000; count += 3)
+			{
+				indexed_bh.erase(indexed_bh.get_iterator(bh_pointers[static_cast<size_t>(count)]));
+			}
+
+			indexed_bh.erase(std::next(indexed_bh.begin(), 1000), std::next(indexed_bh.begin(), 2000)); // Empties groups, which are retained as unused
+			bool indexed = indexed_bh.group_index_enabled();
+
+			for (bitset_hive::iterator it = indexed_bh.begin(); it != indexed_bh.end(); ++it)
+			{
+				if (indexed_bh.get_iterator(&*it) != it)
+				{
+					indexed = false;
+				}
+			}
+
+			int outside = 0;
+			failpass("Group index test", indexed && indexed_bh.get_iterator(bh_pointers[0]) == indexed_bh.end() && indexed_bh.get_iterator(&outside) == indexed_bh.end());
+
+			indexed_bh.disable_group_index();
+			failpass("Disable group index test", !indexed_bh.group_index_enabled() && *indexed_bh.get_iterator(bh_pointers[1]) == 1);
+
+			hive<int> performance_hive(100000, 1);
+			bitset_hive filled_bh(100000, 1);
+			failpass("Memory use test", filled_bh.memory() < performance_hive.memory());
+
+			global_counter = 0;
+
+			{
+				hive<small_struct_non_trivial, std::allocator<small_struct_non_trivial>, hive_priority::bitset> nt_hive;
+
+				for (int count = 0; count != 1000; ++count)
+				{
+					nt_hive.insert(small_struct_non_trivial(count));
+				}
+
+				global_counter = 0;
+				nt_hive.erase(std::next(nt_hive.begin(), 100), std::next(nt_hive.begin(), 400));
+				nt_hive.erase(nt_hive.begin());
+			}
+
+			failpass("Non-trivial destruction test", global_counter == 1000);
+		}
+
+		{
+			title2("Trivially-copyable copy tests");
+
+			hive<int> source(plf::hive_limits(8, 100)), destination(plf::hive_limits(8, 100));
+
+			for (int count = 0; count != 5000; ++count)
+			{
+				source.insert(count);
+			}
+
+			for (hive<int>::iterator it = source.begin(); it != source.end();)
+			{
+				it = ((rand() & 3) == 0) ? source.erase(it) : std::next(it);
+			}
+
+			source.erase(source.begin(), std::next(source.begin(), 50));
+
+			hive<int> copy(source);
+
+			failpass("Copy construct test", copy == source && static_cast<hive<int>::size_type>(distance(copy.begin(), copy.end())) == source.size());
+
+			destination = source;
+			destination = source;
+			const hive<int>::size_type destination_capacity = destination.capacity();
+			destination = source;
+
+			failpass("Copy assignment reuse test", destination == source && destination.capacity() == destination_capacity);
+
+			const int total = std::accumulate(source.begin(), source.end(), 0);
+
+			for (int count = 0; count != 200; ++count)
+			{
+				copy.insert(count);
+			}
+
+			failpass("Insert after copy test", copy.size() == source.size() + 200 && std::accumulate(copy.begin(), copy.end(), 0) == total + 19900 && copy.get_iterator(&*std::next(copy.begin(), 100)) == std::next(copy.begin(), 100));
+
+			hive<int> small_limits(plf::hive_limits(8, 20));
+			small_limits = source;
+
+			failpass("Copy assignment to smaller limits test", small_limits == source && small_limits.block_limits().max == 20);
+		}
+
+		#ifdef PLF_TEST_EXECUTION_POLICY_SUPPORT
+		{
+			title2("Parallel insert tests");
+
+			hive<int> i_hive(plf::hive_limits(8, 100));
+
+			i_hive.insert(std::execution::par, 5000, 3);
+
+			failpass("Parallel fill-insert to empty hive test", i_hive.size() == 5000 && static_cast<hive<int>::size_type>(distance(i_hive.begin(), i_hive.end())) == 5000 && std::accumulate(i_hive.begin(), i_hive.end(), 0) == 15000);
+
+			for (hive<int>::iterator it = i_hive.begin(); it != i_hive.end();)
+			{
+				it = ((rand() & 3) == 0) ? i_hive.erase(it) : std::next(it);
+			}
+
+			const hive<int>::size_type size = i_hive.size();
+			std::vector<int> values(20000);
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				values[static_cast<std::size_t>(count)] = count;
+			}
+
+			i_hive.insert(std::execution::par, values.begin(), values.end());
+
+			failpass("Parallel range-insert with erasures test", i_hive.size() == size + 20000 && static_cast<hive<int>::size_type>(distance(i_hive.begin(), i_hive.end())) == i_hive.size() && std::accumulate(i_hive.begin(), i_hive.end(), 0LL) == static_cast<long long>(size) * 3 + 199990000LL);
+			failpass("Parallel insert get_iterator test", i_hive.get_iterator(&*std::next(i_hive.begin(), 10000)) == std::next(i_hive.begin(), 10000));
+
+			i_hive.insert(std::execution::par_unseq, 50, 1);
+			failpass("Parallel fill-insert smaller than free capacity test", i_hive.size() == size + 20050);
+
+			global_counter = 0;
+
+			{
+				hive<small_struct_non_trivial> nt_hive;
+				nt_hive.insert(std::execution::par, 10000, small_struct_non_trivial(1));
+				failpass("Parallel non-trivial fill-insert test", nt_hive.size() == 10000 && static_cast<hive<small_struct_non_trivial>::size_type>(distance(nt_hive.begin(), nt_hive.end())) == 10000);
+			}
+
+			failpass("Parallel non-trivial destruction test", global_counter == 10001);
+
+			hive<throwing_copy_type> t_hive(plf::hive_limits(8, 100));
+			t_hive.insert(std::execution::par, 300, throwing_copy_type(1));
+			t_hive.erase(std::next(t_hive.begin(), 10), std::next(t_hive.begin(), 20));
+
+			copies_until_throw = 2000;
+			bool thrown = false;
+
+			try
+			{
+				t_hive.insert(std::execution::par, 5000, throwing_copy_type(1));
+			}
+			catch (const std::runtime_error &)
+			{
+				thrown = true;
+			}
+
+			copies_until_throw = -1000000;
+
+			failpass("Parallel insert exception test", thrown && t_hive.size() >= 290 && t_hive.size() <= 320 && static_cast<hive<throwing_copy_type>::size_type>(distance(t_hive.begin(), t_hive.end())) == t_hive.size());
+
+			t_hive.insert(std::execution::par, 5000, throwing_copy_type(1));
+			failpass("Parallel insert after exception test", static_cast<hive<throwing_copy_type>::size_type>(distance(t_hive.begin(), t_hive.end())) == t_hive.size() && t_hive.size() >= 5290);
+
+			hive<int, std::allocator<int>, hive_priority::bitset> b_hive(plf::hive_limits(8, 100));
+			b_hive.insert(std::execution::par, 5000, 3);
+			b_hive.erase(std::next(b_hive.begin(), 100), std::next(b_hive.begin(), 300));
+			b_hive.insert(std::execution::par, values.begin(), values.end());
+
+			failpass("Bitset parallel insert test", b_hive.size() == 24800 && static_cast<hive<int>::size_type>(distance(b_hive.begin(), b_hive.end())) == 24800 && std::accumulate(b_hive.begin(), b_hive.end(), 0LL) == 4800LL * 3 + 199990000LL);
+		}
+		#endif
 	}
 
 	title1("Test Suite PASS - Press ENTER to Exit");
@@ -0,0 +1,353 @@
+#include <numeric> // std::accumulate
+#include <vector> // reference contents
+#include <algorithm> // std::sort, std::equal
+#include <string> // non-trivial field testing
+#include <cstdio> // log redirection, printf
+#include <cstdlib> // abort
+#include <utility> // std::move
+
+#include "plf_rand.h"
+#include "plf_soa_colony.h"
+
+
+
+void title1(const char *title_text)
+{
+	printf("\n\n\n*** %s ***\n", title_text);
+	printf("===========================================\n\n\n");
+}
+
+void title2(const char *title_text)
+{
+	printf("\n\n--- %s ---\n\n", title_text);
+}
+
+
+void failpass(const char *test_type, bool condition)
+{
+	printf("%s: ", test_type);
+
+	if (condition)
+	{
+		printf("Pass\n");
+	}
+	else
+	{
+		printf("Fail\n");
+		getchar();
+		abort();
+	}
+}
+
+
+
+int global_counter = 0;
+
+struct counted_field // counts destructions
+{
+	int number;
+
+	counted_field(const int num) : number(num) {}
+	counted_field(const counted_field &source) : number(source.number) {}
+	~counted_field() { ++global_counter; }
+};
+
+
+
+struct throwing_field // throws on construction from a negative number
+{
+	int number;
+
+	throwing_field(const int num) : number(num)
+	{
+		if (num < 0)
+		{
+			throw num;
+		}
+	}
+};
+
+
+
+struct alignas(32) aligned_field
+{
+	float values[8];
+};
+
+
+
+// Checks the id column against a sorted reference, iterating forwards and backwards:
+template <class soa_colony_type>
+bool contents_match(const soa_colony_type &colony, std::vector<int> expected)
+{
+	std::vector<int> ids;
+
+	for (typename soa_colony_type::const_iterator it = colony.begin(); it != colony.end(); ++it)
+	{
+		ids.push_back(it.template get<0>());
+	}
+
+	unsigned int reverse_count = 0;
+
+	if (!colony.empty())
+	{
+		typename soa_colony_type::const_iterator it = colony.end();
+
+		do
+		{
+			--it;
+			++reverse_count;
+		} while (it != colony.begin());
+	}
+
+	std::sort(ids.begin(), ids.end());
+	std::sort(expected.begin(), expected.end());
+	return ids == expected && reverse_count == expected.size() && colony.size() == expected.size();
+}
+
+
+
+int main()
+{
+	freopen("error.log","w", stderr);
+
+	using namespace std;
+	using namespace plf;
+
+
+	for (unsigned int looper = 0; looper != 100; ++looper)
+	{
+		{
+			title1("SoA Colony");
+			title2("Test Basics");
+
+			soa_colony<int, double, short> s_colony;
+
+			failpass("Empty test", s_colony.empty() && s_colony.begin() == s_colony.end() && s_colony.size() == 0);
+
+			for (int count = 0; count != 400; ++count)
+			{
+				s_colony.insert(count, count * 0.5, static_cast<short>(count & 7));
+			}
+
+			failpass("Size test", s_colony.size() == 400 && s_colony.capacity() >= 400);
+
+			int total = 0;
+			bool fields_match = true;
+
+			for (soa_colony<int, double, short>::iterator it = s_colony.begin(); it != s_colony.end(); ++it)
+			{
+				const auto [id, half, low_bits] = *it;
+				total += id;
+
+				if (half != id * 0.5 || low_bits != static_cast<short>(id & 7) || it.get<1>() != half)
+				{
+					fields_match = false;
+				}
+			}
+
+			failpass("Iteration test", total == 399 * 200 && fields_match);
+
+			for (soa_colony<int, double, short>::iterator it = s_colony.begin(); it != s_colony.end(); ++it)
+			{
+				std::get<1>(*it) = 2.0;
+				it.get<2>() = 1;
+			}
+
+			double double_total = 0;
+			int short_total = 0;
+			s_colony.for_each<1, 2>([&](double &value, short &low_bits) { double_total += value; short_total += low_bits; });
+			failpass("Proxy reference write test", double_total == 800.0 && short_total == 400);
+
+			soa_colony<int, double, short>::const_iterator c_it = s_colony.begin();
+			++c_it;
+			failpass("Const iterator test", c_it.get<0>() == 1 && c_it != s_colony.begin() && s_colony.begin() < c_it && c_it > s_colony.cbegin());
+		}
+
+		{
+			title2("Erase tests");
+
+			soa_colony<int, float> s_colony;
+			vector<int> expected;
+
+			for (int count = 0; count != 20000; ++count)
+			{
+				s_colony.insert(count, static_cast<float>(count));
+				expected.push_back(count);
+			}
+
+			for (soa_colony<int, float>::iterator it = s_colony.begin(); it != s_colony.end();)
+			{
+				if ((plf::rand() & 3) == 0 || (it.get<0>() >= 5000 && it.get<0>() < 7000))
+				{
+					expected.erase(std::find(expected.begin(), expected.end(), it.get<0>()));
+					it = s_colony.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			failpass("Erase test", contents_match(s_colony, expected));
+
+			const unsigned int capacity = static_cast<unsigned int>(s_colony.capacity());
+
+			for (int count = 20000; count != 22000; ++count)
+			{
+				s_colony.insert(count, static_cast<float>(count));
+				expected.push_back(count);
+			}
+
+			failpass("Erased slot reuse test", contents_match(s_colony, expected) && s_colony.capacity() == capacity);
+
+			for (unsigned int count = 0; count != 3000; ++count) // Random single erasures
+			{
+				soa_colony<int, float>::iterator it = s_colony.begin();
+
+				for (unsigned int skip = static_cast<unsigned int>(plf::rand()) % 200; skip != 0 && it != s_colony.end(); --skip)
+				{
+					++it;
+				}
+
+				if (it != s_colony.end())
+				{
+					expected.erase(std::find(expected.begin(), expected.end(), it.get<0>()));
+					s_colony.erase(it);
+				}
+			}
+
+			failpass("Random erase test", contents_match(s_colony, expected));
+
+			bool fields_match = true;
+			s_colony.for_each<0, 1>([&](const int id, const float value) { if (static_cast<float>(id) != value) fields_match = false; });
+			failpass("Column consistency test", fields_match);
+
+			s_colony.erase(s_colony.begin(), s_colony.end());
+			failpass("Range erase test", s_colony.empty() && s_colony.begin() == s_colony.end());
+
+			s_colony.insert(1, 1.0f);
+			failpass("Insert after erase test", s_colony.size() == 1 && s_colony.begin().get<0>() == 1);
+		}
+
+		{
+			title2("Column iteration tests");
+
+			soa_colony<float, int, aligned_field> s_colony;
+			aligned_field field = {};
+
+			for (int count = 0; count != 10000; ++count)
+			{
+				s_colony.insert(1.5f, count, field);
+			}
+
+			bool aligned = true;
+
+			for (soa_colony<float, int, aligned_field>::iterator it = s_colony.begin(); it != s_colony.end(); ++it)
+			{
+				if (reinterpret_cast<size_t>(&(it.get<2>())) % 32 != 0)
+				{
+					aligned = false;
+				}
+			}
+
+			failpass("Column alignment test", aligned);
+
+			float float_total = 0;
+			s_colony.for_each<0>([&](const float value) { float_total += value; });
+			failpass("Single column test", float_total == 15000.0f);
+
+			for (soa_colony<float, int, aligned_field>::iterator it = s_colony.begin(); it != s_colony.end();)
+			{
+				it = ((it.get<1>() % 3) == 0) ? s_colony.erase(it) : ++it;
+			}
+
+			long long int_total = 0;
+			const soa_colony<float, int, aligned_field> &const_colony = s_colony;
+			const_colony.for_each<1>([&](const int value) { int_total += value; });
+
+			long long expected_total = 0;
+
+			for (int count = 0; count != 10000; ++count)
+			{
+				if (count % 3 != 0)
+				{
+					expected_total += count;
+				}
+			}
+
+			failpass("Column iteration with erasures test", int_total == expected_total);
+		}
+
+		{
+			title2("Non-trivial field tests");
+
+			{
+				soa_colony<std::string, counted_field> s_colony;
+
+				for (int count = 0; count != 1000; ++count)
+				{
+					s_colony.insert(std::string(40, 'a'), count);
+				}
+
+				global_counter = 0;
+
+				for (soa_colony<std::string, counted_field>::iterator it = s_colony.begin(); it != s_colony.end();)
+				{
+					it = ((it.get<1>().number & 1) == 0) ? s_colony.erase(it) : ++it;
+				}
+
+				failpass("Erase destruction test", global_counter == 500 && s_colony.size() == 500);
+
+				soa_colony<std::string, counted_field> s_colony2(s_colony);
+				failpass("Copy test", s_colony2.size() == 500 && s_colony2.begin().get<0>() == std::string(40, 'a') && s_colony2.begin().get<1>().number == 1);
+
+				soa_colony<std::string, counted_field> s_colony3(std::move(s_colony2));
+				failpass("Move test", s_colony3.size() == 500 && s_colony2.empty());
+
+				s_colony3.swap(s_colony2);
+				failpass("Swap test", s_colony2.size() == 500 && s_colony3.empty());
+
+				global_counter = 0;
+				s_colony2.clear();
+				failpass("Clear test", global_counter == 500 && s_colony2.empty() && s_colony2.begin() == s_colony2.end());
+
+				s_colony2.trim();
+				s_colony2.insert(std::string("b"), 1);
+				failpass("Insert after clear test", s_colony2.size() == 1 && s_colony2.begin().get<0>() == "b");
+
+				global_counter = 0;
+			}
+
+			failpass("Destructor test", global_counter == 501);
+
+			soa_colony<counted_field, throwing_field> t_colony;
+
+			for (int count = 0; count != 100; ++count)
+			{
+				t_colony.insert(count, count);
+			}
+
+			t_colony.erase(t_colony.begin());
+			global_counter = 0;
+
+			try
+			{
+				t_colony.insert(-1, -1);
+			}
+			catch (int)
+			{
+			}
+
+			failpass("Exception rollback test", global_counter == 1 && t_colony.size() == 99);
+
+			t_colony.insert(100, 100);
+			failpass("Insert after exception test", t_colony.size() == 100 && t_colony.begin().get<0>().number == 100);
+		}
+	}
+
+	title1("Test Suite PASS - Press ENTER to Exit");
+	getchar();
+
+	return 0;
+}